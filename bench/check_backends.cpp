@@ -0,0 +1,153 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file check_backends.cpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Benchmark of the overflow checks of the backend the program is
+ *          built with.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Usage: check_backends [ELEMENTS]
+ *
+ * Build it once per backend, e.g. in build trees configured with each value
+ * of OVERFLOWWRAPPER_BACKEND, and compare the nanoseconds per operation.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../include/intwrapper.hpp"
+
+
+
+
+
+namespace
+{
+
+constexpr const char *backend_name = OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_ASM       ? "asm"
+                                     : OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_BUILTIN ? "builtin"
+                                                                                                  : "portable";
+
+/**
+ * @brief Random values of T, a few of them close to its limits so that some
+ *        operations overflow.
+ */
+template <std::integral T>
+std::vector<T> Values(std::size_t n, std::mt19937_64 &rng)
+{
+    using Limits = std::numeric_limits<T>;
+
+    std::vector<T> values(n);
+    for (T &val : values)
+    {
+        const std::uint64_t r = rng();
+        if (r % 64 == 0)
+            val = (r & 64) != 0 ? Limits::max() : Limits::min();
+        else
+            // Small enough that most products of 64-bit values fit
+            val = static_cast<T>(static_cast<T>(r >> 8) / (sizeof(T) == 8 ? 0x10000 : 1));
+    }
+    return values;
+}
+
+/**
+ * @brief Runs a kernel over the inputs a few times and prints its best time
+ *        per element.
+ */
+template <typename Kernel>
+void Measure(const char *name, std::size_t n, Kernel kernel)
+{
+    constexpr int runs = 7;
+    constexpr int reps = 16;
+
+    double best = std::numeric_limits<double>::max();
+    long long sink = 0;
+
+    for (int run = 0; run < runs; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < reps; ++rep)
+            sink += kernel();
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count() / reps / static_cast<double>(n));
+    }
+
+    std::printf("%-10s %-24s %8.3f ns/op   (%lld)\n", backend_name, name, best, sink);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t{1} << 14;
+
+    std::mt19937_64 rng(1);
+    const auto i32_a = Values<std::int32_t>(n, rng);
+    const auto i32_b = Values<std::int32_t>(n, rng);
+    const auto u32_b = Values<std::uint32_t>(n, rng);
+    const auto i64_a = Values<std::int64_t>(n, rng);
+    const auto i64_b = Values<std::int64_t>(n, rng);
+    const auto u64_a = Values<std::uint64_t>(n, rng);
+    const auto u64_b = Values<std::uint64_t>(n, rng);
+
+    // Number of overflows, so that the checks aren't optimized away
+    const auto count = [n](const auto &a, const auto &b, auto check)
+    {
+        return [n, &a, &b, check]
+        {
+            long long overflows = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                overflows += check(a[i], b[i]);
+            return overflows;
+        };
+    };
+
+    Measure("Sum int32", n, count(i32_a, i32_b, [](auto l, auto r) { return overflow::checks::Sum(l, r); }));
+    Measure("Sub int32", n, count(i32_a, i32_b, [](auto l, auto r) { return overflow::checks::Sub(l, r); }));
+    Measure("Mul int32", n, count(i32_a, i32_b, [](auto l, auto r) { return overflow::checks::Mul(l, r); }));
+    Measure("Sum int64 + uint32", n, count(i64_a, u32_b, [](auto l, auto r) { return overflow::checks::Sum(l, r); }));
+    Measure("Mul int64", n, count(i64_a, i64_b, [](auto l, auto r) { return overflow::checks::Mul(l, r); }));
+    Measure("Mul uint64", n, count(u64_a, u64_b, [](auto l, auto r) { return overflow::checks::Mul(l, r); }));
+    Measure("Mul int64 * uint32", n, count(i64_a, u32_b, [](auto l, auto r) { return overflow::checks::Mul(l, r); }));
+    Measure("TryMul int64", n, count(i64_a, i64_b, [](auto l, auto r)
+                                     { return static_cast<long long>(overflow::TryMul(l, r).value & 1); }));
+
+    // Checked dot product, products and sum checked by the wrapper
+    Measure("IntWrapper dot int32", n,
+            [&]
+            {
+                overflow::IntWrapper<std::int64_t> sum;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    overflow::IntWrapper<std::int64_t> product = i32_a[i] >> 16;
+                    product *= i32_b[i] >> 16;
+                    sum += product;
+                }
+                return static_cast<long long>(sum.Get());
+            });
+
+    return 0;
+}
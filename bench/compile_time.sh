@@ -0,0 +1,107 @@
+#!/usr/bin/env bash
+#
+#   Copyright © 2021 Luiz Fernando F. G. Valle
+#   This program is free software: you can redistribute it and/or modify
+#   it under the terms of the GNU General Public License as published by
+#   the Free Software Foundation, either version 3 of the License, or
+#   (at your option) any later version.
+#   This program is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#   GNU General Public License for more details.
+#   You should have received a copy of the GNU General Public License
+#   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# @file compile_time.sh
+# @brief Compile-time benchmark of IntWrapper.
+#
+# Usage: bench/compile_time.sh [OUTPUT_DIR]
+#
+# Times, with $CXX (clang++ if found, else g++):
+#   - a translation unit that includes intwrapper.hpp, against one that
+#     imports the overflow module;
+#   - bench/compile_time_operators.cpp at -O0 and -O2, with and without the
+#     explicit instantiation declarations of intwrapper_extern.hpp.
+# Then profiles compile_time_operators.cpp: with clang, -ftime-trace, which
+# ClangBuildAnalyzer summarizes if it's in the PATH; with GCC, -ftime-report.
+
+set -euo pipefail
+
+root="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+out="${1:-$(mktemp -d)}"
+mkdir -p "$out"
+cd "$out"
+
+if [[ -z "${CXX:-}" ]]; then
+    if command -v clang++ > /dev/null; then CXX=clang++; else CXX=g++; fi
+fi
+if "$CXX" --version | grep -q clang; then clang=1; else clang=0; fi
+
+flags=(-std=c++20 -I"$root/include")
+operators="$root/bench/compile_time_operators.cpp"
+
+TIMEFORMAT="%R s"
+measure()
+{
+    local label="$1"
+    shift
+    printf '%-48s ' "$label"
+    { time "$@" > /dev/null 2>&1; } 2>&1
+}
+
+
+
+
+
+# Including against importing ------------------------------------------------ >>
+
+printf '#include <intwrapper.hpp>\nint main() { return overflow::IntWrapper<int>{1}; }\n' > include.cpp
+printf '#include <source_location>\nimport overflow;\nint main() { return overflow::IntWrapper<int>{1}; }\n' > import.cpp
+
+if (( clang )); then
+    "$CXX" "${flags[@]}" --precompile -x c++-module "$root/include/overflow.cppm" -o overflow.pcm
+    module_flags=(-fmodule-file=overflow=overflow.pcm)
+else
+    "$CXX" "${flags[@]}" -fmodules-ts -c -x c++ "$root/include/overflow.cppm" -o overflow.o
+    module_flags=(-fmodules-ts)
+fi
+
+measure "#include <intwrapper.hpp>" "$CXX" "${flags[@]}" -c include.cpp -o include.o
+measure "import overflow;" "$CXX" "${flags[@]}" "${module_flags[@]}" -c import.cpp -o import.o
+
+
+
+
+
+# Explicit instantiations ----------------------------------------------------- >>
+
+for opt in -O0 -O2; do
+    measure "compile_time_operators.cpp $opt" "$CXX" "${flags[@]}" "$opt" -c "$operators" -o operators.o
+    measure "compile_time_operators.cpp $opt, extern templates" \
+        "$CXX" "${flags[@]}" "$opt" -DOVERFLOWWRAPPER_EXTERN_TEMPLATES -c "$operators" -o operators_extern.o
+done
+
+# Check that the program links against the instantiations
+"$CXX" "${flags[@]}" -O2 -c "$root/src/intwrapper_instantiations.cpp" -o instantiations.o
+"$CXX" operators_extern.o instantiations.o -o operators_extern
+./operators_extern > /dev/null
+
+
+
+
+
+# Profile --------------------------------------------------------------------- >>
+
+if (( clang )); then
+    analyzer=0
+    if command -v ClangBuildAnalyzer > /dev/null; then analyzer=1; fi
+    if (( analyzer )); then ClangBuildAnalyzer --start "$out"; fi
+    "$CXX" "${flags[@]}" -O0 -ftime-trace -c "$operators" -o operators.o
+    echo "Trace: $out/operators.json (chrome://tracing or https://ui.perfetto.dev)"
+    if (( analyzer )); then
+        ClangBuildAnalyzer --stop "$out" capture.bin
+        ClangBuildAnalyzer --analyze capture.bin
+    fi
+else
+    "$CXX" "${flags[@]}" -O0 -ftime-report -c "$operators" -o operators.o 2>&1 | head -n 40
+fi
@@ -0,0 +1,133 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file compile_time_operators.cpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Compile-time benchmark: a translation unit that uses every operator
+ *          of IntWrapper for every pair of the fixed-width integral types.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Build it with bench/compile_time.sh, which reports where the compiler
+ * spends its time. The program itself only prints a checksum, so that no
+ * operation is optimized away.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <tuple>
+#include <utility>
+
+#include "../include/intwrapper.hpp"
+
+
+
+
+
+namespace
+{
+
+using Types = std::tuple<std::int8_t, std::int16_t, std::int32_t, std::int64_t,
+                         std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t>;
+
+template <std::integral T, std::integral RhsT>
+long long Exercise(long long seed)
+{
+    using W = overflow::IntWrapper<T>;
+
+    W val = static_cast<T>(seed & 0x3F);
+    const RhsT rhs = static_cast<RhsT>((seed & 0x7) + 1);
+    long long sum = 0;
+
+    try
+    {
+        val += rhs;
+        val -= rhs;
+        val *= rhs;
+        val /= rhs;
+        val %= rhs;
+        val &= rhs;
+        val |= rhs;
+        val ^= rhs;
+        val <<= static_cast<RhsT>(1);
+        val >>= static_cast<RhsT>(1);
+        val = rhs;
+
+        val.Add(rhs);
+        val.Sub(rhs);
+        val.Mul(rhs);
+        val.Div(rhs);
+        val.Assign(rhs);
+
+        sum += static_cast<int>(val.TryAdd(rhs)) + static_cast<int>(val.TrySub(rhs))
+               + static_cast<int>(val.TryMul(rhs)) + static_cast<int>(val.TryDiv(rhs))
+               + static_cast<int>(val.TryAssign(rhs));
+
+        const W wrapped_rhs = static_cast<T>(rhs);
+        sum += static_cast<long long>((val + rhs).Get()) + static_cast<long long>((val - rhs).Get())
+               + static_cast<long long>((val * rhs).Get()) + static_cast<long long>((val / rhs).Get())
+               + static_cast<long long>((val % rhs).Get()) + static_cast<long long>((val + wrapped_rhs).Get())
+               + static_cast<long long>((rhs + wrapped_rhs).Get());
+
+        sum += (val == wrapped_rhs) + (val != wrapped_rhs) + (val < wrapped_rhs) + (val <= wrapped_rhs)
+               + (val > wrapped_rhs) + (val >= wrapped_rhs);
+    }
+    catch (const std::overflow_error &)
+    {
+        sum -= 1;
+    }
+
+    if constexpr (std::is_same_v<T, RhsT>)
+    {
+        try
+        {
+            ++val;
+            val++;
+            --val;
+            val--;
+            sum += static_cast<long long>((~val).Get()) + static_cast<long long>(overflow::Abs(val).Get());
+            if constexpr (std::is_signed_v<T>)
+                sum += static_cast<long long>((-val).Get());
+        }
+        catch (const std::overflow_error &)
+        {
+            sum -= 1;
+        }
+    }
+
+    return sum;
+}
+
+template <std::size_t... Lhs, std::size_t... Rhs>
+long long ExerciseAll(long long seed, std::index_sequence<Lhs...>, std::index_sequence<Rhs...> rhs)
+{
+    const auto row = [seed, rhs]<std::size_t L>(std::integral_constant<std::size_t, L>)
+    {
+        return (Exercise<std::tuple_element_t<L, Types>, std::tuple_element_t<Rhs, Types>>(seed) + ...);
+    };
+    (void)rhs;
+    return (row(std::integral_constant<std::size_t, Lhs>{}) + ...);
+}
+
+} // namespace
+
+int main(int argc, char **)
+{
+    constexpr auto indices = std::make_index_sequence<std::tuple_size_v<Types>>{};
+    std::printf("%lld\n", ExerciseAll(argc, indices, indices));
+    return 0;
+}
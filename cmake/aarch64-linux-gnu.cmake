@@ -0,0 +1,36 @@
+#   Copyright © 2021 Luiz Fernando F. G. Valle
+#   This program is free software: you can redistribute it and/or modify
+#   it under the terms of the GNU General Public License as published by
+#   the Free Software Foundation, either version 3 of the License, or
+#   (at your option) any later version.
+#   This program is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#   GNU General Public License for more details.
+#   You should have received a copy of the GNU General Public License
+#   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+# Cross-compiles for AArch64 Linux with the GNU toolchain and runs the tests
+# under qemu-user, so that the asm backend and its NEON kernels are checked
+# against __int128 like the other backends:
+#
+#   cmake -S . -B build-aarch64 --toolchain cmake/aarch64-linux-gnu.cmake
+#   cmake --build build-aarch64
+#   ctest --test-dir build-aarch64 --output-on-failure
+#
+# Needs g++-aarch64-linux-gnu and qemu-user, e.g. from the Debian packages of
+# those names.
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(CMAKE_CXX_COMPILER aarch64-linux-gnu-g++)
+
+set(CMAKE_FIND_ROOT_PATH /usr/aarch64-linux-gnu)
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_PACKAGE ONLY)
+
+# Used by ctest to run every test program
+set(CMAKE_CROSSCOMPILING_EMULATOR qemu-aarch64 -L /usr/aarch64-linux-gnu)
@@ -0,0 +1,113 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file checks_fuzz.cpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief libFuzzer target comparing the operations of the configured backend
+ *          against exact results computed in __int128.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Each input is an operation, the types of its operands and their bytes. A
+ * mismatch is printed and aborts, which the fuzzer reports with the input.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "../tests/reference.hpp"
+
+
+
+
+
+namespace
+{
+
+using namespace overflow;
+using namespace overflow::test;
+
+template <checks::Operation O>
+void Fuzz(unsigned lhs_type, unsigned rhs_type, std::uint64_t lhs_bits, std::uint64_t rhs_bits)
+{
+    unsigned i = 0;
+    ForEachType(FixedWidth{}, [&]<typename Lhs>(std::type_identity<Lhs>)
+    {
+        unsigned j = 0;
+        ForEachType(FixedWidth{}, [&]<typename Rhs>(std::type_identity<Rhs>)
+        {
+            if (i == lhs_type && j == rhs_type)
+            {
+                const auto lhs = static_cast<Lhs>(lhs_bits);
+                const auto rhs = static_cast<Rhs>(rhs_bits);
+
+                const std::string mismatch = Verify<O>(lhs, rhs);
+                if (!mismatch.empty())
+                {
+                    std::fprintf(stderr, "%s: %s(%s, %s)\n", mismatch.c_str(), checks::Name(O),
+                                 ToString(lhs).c_str(), ToString(rhs).c_str());
+                    std::abort();
+                }
+            }
+            ++j;
+        });
+        ++i;
+    });
+}
+
+} // namespace
+
+
+
+
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size)
+{
+    using checks::Operation;
+
+    if (size < 18)
+        return 0;
+
+    const unsigned op = data[0] % 10;
+    const unsigned lhs_type = data[1] % 8;
+    const unsigned rhs_type = (data[1] / 8) % 8;
+
+    std::uint64_t lhs;
+    std::uint64_t rhs;
+    std::memcpy(&lhs, data + 2, sizeof(lhs));
+    std::memcpy(&rhs, data + 10, sizeof(rhs));
+
+    switch (op)
+    {
+    case 0: Fuzz<Operation::Assign>(lhs_type, rhs_type, lhs, rhs); break;
+    case 1: Fuzz<Operation::Sum>(lhs_type, rhs_type, lhs, rhs); break;
+    case 2: Fuzz<Operation::Sub>(lhs_type, rhs_type, lhs, rhs); break;
+    case 3: Fuzz<Operation::Mul>(lhs_type, rhs_type, lhs, rhs); break;
+    case 4: Fuzz<Operation::Div>(lhs_type, rhs_type, lhs, rhs); break;
+    case 5: Fuzz<Operation::Shl>(lhs_type, rhs_type, lhs, rhs); break;
+    case 6: Fuzz<Operation::Shr>(lhs_type, rhs_type, lhs, rhs); break;
+    case 7: Fuzz<Operation::Inc>(lhs_type, lhs_type, lhs, rhs); break;
+    case 8: Fuzz<Operation::Dec>(lhs_type, lhs_type, lhs, rhs); break;
+    default: Fuzz<Operation::Neg>(lhs_type, lhs_type, lhs, rhs); break;
+    }
+
+    return 0;
+}
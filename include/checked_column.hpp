@@ -0,0 +1,487 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file checked_column.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides a contiguous column of integers with batched,
+ *          overflow-checked operations.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_COLUMN_HPP
+#define OVERFLOWWRAPPER_INCLUDE_CHECKED_COLUMN_HPP
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+// -------------------------------------------------------------------------- >>
+//                                Batch results                               >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Outcome of a batched operation.
+ */
+struct BatchResult
+{
+    /**
+     * @brief Whether any element overflowed.
+     */
+    bool overflow = false;
+
+    /**
+     * @brief Index of the first element that overflowed, the number of
+     *        elements if none did.
+     */
+    std::size_t first = 0;
+
+    [[nodiscard]] constexpr bool Ok() const { return !overflow; }
+
+    constexpr explicit operator bool() const { return Ok(); }
+};
+
+/**
+ * @brief Sum of a column and the outcome of computing it.
+ *
+ * @tparam T Integral type of the column
+ */
+template <std::integral T>
+struct BatchSum
+{
+    /**
+     * @brief Sum, wrapped around the range of T if it overflowed.
+     */
+    T value = 0;
+
+    /**
+     * @brief Outcome, first being the element that took the running sum out
+     *        of the range of T.
+     */
+    BatchResult status;
+};
+
+namespace detail
+{
+
+#ifdef __SIZEOF_INT128__
+__extension__ using Int128 = __int128;
+#endif
+
+/**
+ * @brief Type wide enough to sum a block of values of T and a running sum in
+ *        the range of T exactly, void if there is none.
+ */
+template <std::integral T>
+using SumType = std::conditional_t<
+    sizeof(T) < sizeof(long long),
+    std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>,
+#ifdef __SIZEOF_INT128__
+    std::conditional_t<std::is_signed_v<T>, Int128, checks::detail::UInt128>
+#else
+    void
+#endif
+    >;
+
+} // namespace detail
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                                CheckedColumn                               >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Column of integers stored contiguously as raw T, with checked
+ *        operations applied to the whole column at once.
+ *
+ * Elements are processed in blocks whose overflow flags are computed without
+ * branches and reduced once per block, so the loops vectorize. Operations
+ * don't stop at the first overflow: every element gets its result wrapped
+ * around the range of T, like the Try* functions, and the BatchResult tells
+ * whether and where the column overflowed. Overflows of mutating operations
+ * are also accumulated in a sticky status until it's cleared.
+ *
+ * @tparam T Integral type of the elements
+ */
+template <std::integral T>
+class CheckedColumn
+{
+public:
+    using value_type = T;
+
+    static constexpr std::size_t block = 64;
+
+    CheckedColumn() = default;
+
+    explicit CheckedColumn(std::size_t count, const T &val = T{0})
+        : values(count, val) {}
+
+    CheckedColumn(std::initializer_list<T> init)
+        : values(init) {}
+
+    explicit CheckedColumn(std::vector<T> init)
+        : values(std::move(init)) {}
+
+    explicit CheckedColumn(std::span<const T> init)
+        : values(init.begin(), init.end()) {}
+
+    [[nodiscard]] std::size_t Size() const { return values.size(); }
+
+    [[nodiscard]] bool Empty() const { return values.empty(); }
+
+    [[nodiscard]] T *Data() { return values.data(); }
+
+    [[nodiscard]] const T *Data() const { return values.data(); }
+
+    /**
+     * @brief Gets the elements, e.g. for iterating or CheckedNarrow.
+     */
+    [[nodiscard]] std::span<T> Values() { return values; }
+
+    [[nodiscard]] std::span<const T> Values() const { return values; }
+
+    [[nodiscard]] T &operator[](std::size_t idx) { return values[idx]; }
+
+    [[nodiscard]] const T &operator[](std::size_t idx) const { return values[idx]; }
+
+    void PushBack(const T &val) { values.push_back(val); }
+
+    void Resize(std::size_t count, const T &val = T{0}) { values.resize(count, val); }
+
+    /**
+     * @brief Gets the overflows of every mutating operation since the column
+     *        was created or the status cleared, first being the index reported
+     *        by the first operation that overflowed, or the size if none did.
+     */
+    [[nodiscard]] BatchResult Status() const
+    {
+        return {overflowed, overflowed ? first_overflow : Size()};
+    }
+
+    void ClearStatus()
+    {
+        overflowed = false;
+        first_overflow = 0;
+    }
+
+
+
+    /**
+     * @brief Adds rhs to the column element by element.
+     *
+     * @throw std::invalid_argument If rhs doesn't have the same size, which
+     *        aborts if exceptions are disabled
+     */
+    BatchResult Add(const CheckedColumn &rhs)
+    {
+        CheckSize(rhs, "CheckedColumn::Add: columns of different sizes");
+        const T *r = rhs.values.data();
+
+#ifdef OVERFLOWWRAPPER_ASM_SPANS
+        if constexpr (checks::detail::AsmSpan<T>::supported)
+        {
+            const std::size_t first = checks::detail::AsmSpan<T>::Add(values.data(), r, values.size());
+            return Record({first != values.size(), first});
+        }
+#endif
+
+        return Update([r](T &val, std::size_t idx)
+        {
+            const T sum = wrapping::Sum(val, r[idx]);
+            bool overflow;
+            if constexpr (std::is_signed_v<T>)
+                // Operands of the same sign, result of the other
+                overflow = ((val ^ sum) & (r[idx] ^ sum)) < 0;
+            else
+                overflow = sum < val;
+            val = sum;
+            return overflow;
+        });
+    }
+
+    /**
+     * @brief Subtracts rhs from the column element by element.
+     *
+     * @throw std::invalid_argument If rhs doesn't have the same size, which
+     *        aborts if exceptions are disabled
+     */
+    BatchResult Sub(const CheckedColumn &rhs)
+    {
+        CheckSize(rhs, "CheckedColumn::Sub: columns of different sizes");
+        const T *r = rhs.values.data();
+
+#ifdef OVERFLOWWRAPPER_ASM_SPANS
+        if constexpr (checks::detail::AsmSpan<T>::supported)
+        {
+            const std::size_t first = checks::detail::AsmSpan<T>::Sub(values.data(), r, values.size());
+            return Record({first != values.size(), first});
+        }
+#endif
+
+        return Update([r](T &val, std::size_t idx)
+        {
+            const T diff = wrapping::Sub(val, r[idx]);
+            bool overflow;
+            if constexpr (std::is_signed_v<T>)
+                // Operands of different signs, result of the subtrahend's
+                overflow = ((val ^ r[idx]) & (val ^ diff)) < 0;
+            else
+                overflow = r[idx] > val;
+            val = diff;
+            return overflow;
+        });
+    }
+
+    /**
+     * @brief Multiplies every element by a scalar, checking each one against
+     *        the range checks::MulRange computes once.
+     */
+    BatchResult Mul(const T &scalar)
+    {
+        const checks::Range<T> range = checks::MulRange<T>(scalar);
+
+        return Update([range, scalar](T &val, std::size_t)
+        {
+            // Not range.Contains, whose && would be a branch
+            const bool overflow = (val < range.low) | (val > range.high);
+            val = wrapping::Mul(val, scalar);
+            return overflow;
+        });
+    }
+
+    CheckedColumn &operator+=(const CheckedColumn &rhs)
+    {
+        Add(rhs);
+        return *this;
+    }
+
+    CheckedColumn &operator-=(const CheckedColumn &rhs)
+    {
+        Sub(rhs);
+        return *this;
+    }
+
+    CheckedColumn &operator*=(const T &scalar)
+    {
+        Mul(scalar);
+        return *this;
+    }
+
+
+
+    /**
+     * @brief Sums the column, reporting the first element whose running sum
+     *        leaves the range of T.
+     *
+     * Each block is summed in a wider type as its positive and negative parts,
+     * and only when the running sum plus either part leaves the range of T is
+     * the block rescanned to find the element.
+     */
+    [[nodiscard]] BatchSum<T> Sum() const
+    {
+        using Wide = detail::SumType<T>;
+        using Limits = std::numeric_limits<T>;
+
+        const std::size_t n = values.size();
+        BatchSum<T> result{0, {false, n}};
+
+        if constexpr (std::is_void_v<Wide>)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (checks::Sum(result.value, values[i]) && !result.status.overflow)
+                    result.status = {true, i};
+                result.value = wrapping::Sum(result.value, values[i]);
+            }
+        }
+        else
+        {
+            const auto outside = [](const Wide &val)
+            {
+                if constexpr (std::is_signed_v<T>)
+                    return val > Limits::max() || val < Limits::min();
+                else
+                    return val > Limits::max();
+            };
+
+            Wide total = 0;
+            std::size_t i = 0;
+
+            while (i < n && !result.status.overflow)
+            {
+                const std::size_t end = n - i < block ? n : i + block;
+
+                Wide up = 0;
+                Wide down = 0;
+                for (std::size_t j = i; j < end; ++j)
+                {
+                    up += values[j] > 0 ? values[j] : 0;
+                    if constexpr (std::is_signed_v<T>)
+                        down += values[j] < 0 ? values[j] : 0;
+                }
+
+                if (!outside(total + up) && !outside(total + down))
+                {
+                    total += up + down;
+                    i = end;
+                    continue;
+                }
+
+                // Rescan, the running sum may still come back before leaving
+                for (; i < end; ++i)
+                {
+                    total += values[i];
+                    if (outside(total))
+                    {
+                        result.status = {true, i};
+                        break;
+                    }
+                }
+            }
+
+            result.value = static_cast<T>(total);
+
+            // After an overflow the rest only contributes to the wrapped value
+            if (result.status.overflow)
+                for (++i; i < n; ++i)
+                    result.value = wrapping::Sum(result.value, values[i]);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Gets the lowest and highest elements, which can't overflow.
+     *
+     * @return Range of the elements, high below low if the column is empty
+     */
+    [[nodiscard]] checks::Range<T> MinMax() const
+    {
+        checks::Range<T> range{std::numeric_limits<T>::max(), std::numeric_limits<T>::min()};
+        for (const T &val : values)
+        {
+            range.low = val < range.low ? val : range.low;
+            range.high = val > range.high ? val : range.high;
+        }
+        return range;
+    }
+
+    /**
+     * @brief Gets the elements that satisfy a predicate, in order.
+     *
+     * @param pred Callable taking a T and returning bool, without side effects
+     */
+    template <typename Predicate>
+    [[nodiscard]] CheckedColumn Filter(Predicate pred) const
+    {
+        // Written unconditionally, kept by advancing the output
+        std::vector<T> kept(values.size());
+        std::size_t count = 0;
+        for (const T &val : values)
+        {
+            kept[count] = val;
+            count += pred(val) ? 1 : 0;
+        }
+        kept.resize(count);
+        return CheckedColumn(std::move(kept));
+    }
+
+private:
+    void CheckSize(const CheckedColumn &rhs, const char *what) const
+    {
+        if (rhs.values.size() != values.size())
+            detail::InvalidArgument(what);
+    }
+
+    /**
+     * @brief Applies op(element, index), which stores the wrapped result in
+     *        the element and returns whether it overflowed, to every element.
+     */
+    template <typename Op>
+    BatchResult Update(Op op)
+    {
+        const std::size_t n = values.size();
+        BatchResult result{false, n};
+        T *data = values.data();
+
+        for (std::size_t i = 0; i < n; i += block)
+        {
+            const std::size_t count = n - i < block ? n - i : block;
+
+            std::array<unsigned char, block> flags{};
+            for (std::size_t j = 0; j < count; ++j)
+                flags[j] = op(data[i + j], i + j);
+
+            unsigned char any = 0;
+            for (std::size_t j = 0; j < block; ++j)
+                any |= flags[j];
+
+            if (any != 0 && !result.overflow)
+            {
+                std::size_t j = 0;
+                while (!flags[j])
+                    ++j;
+                result = {true, i + j};
+            }
+        }
+
+        return Record(result);
+    }
+
+    /**
+     * @brief Records the first overflow of a mutating operation.
+     */
+    BatchResult Record(const BatchResult &result)
+    {
+        if (result.overflow && !overflowed)
+        {
+            overflowed = true;
+            first_overflow = result.first;
+        }
+        return result;
+    }
+
+    std::vector<T> values;
+
+    bool overflowed = false;
+    std::size_t first_overflow = 0;
+};
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_COLUMN_HPP
@@ -0,0 +1,334 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file checked_histogram.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides a multithreaded, overflow-checked weighted bin count.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_HISTOGRAM_HPP
+#define OVERFLOWWRAPPER_INCLUDE_CHECKED_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "checked_column.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+/**
+ * @brief Bins counted by CheckedHistogram.
+ *
+ * @tparam CountT Integral type of the bins
+ */
+template <std::integral CountT>
+struct HistogramResult
+{
+    /**
+     * @brief Count or sum of weights of each bin, wrapped around the range of
+     *        CountT if it overflowed.
+     */
+    std::vector<IntWrapper<CountT>> counts;
+
+    /**
+     * @brief Whether any bin overflowed, first being the lowest such bin.
+     */
+    BatchResult status;
+
+    /**
+     * @brief Whether any key was outside the bins, first being the index of
+     *        the first such key. Such keys are skipped.
+     */
+    BatchResult invalid;
+};
+
+/**
+ * @brief Options of CheckedHistogram.
+ */
+struct HistogramOptions
+{
+    /**
+     * @brief Number of worker threads, 0 uses the hardware concurrency.
+     */
+    unsigned threads = 0;
+
+    /**
+     * @brief Fewest keys given to each thread, so that small inputs aren't
+     *        split.
+     */
+    std::size_t min_keys_per_thread = std::size_t{1} << 16;
+};
+
+namespace detail
+{
+
+/**
+ * @brief Accumulator types of a histogram of weights of WeightT.
+ *
+ * Each thread adds the weights to sub-histograms of Acc, folded into its
+ * partial sums of Wide at least every pass keys, before any Acc can
+ * overflow. Weights below 64 bits are summed in 64-bit integers.
+ */
+template <std::integral WeightT>
+struct HistogramTraits
+{
+    using Wide = SumType<std::int64_t>;
+    using Acc = std::conditional_t<sizeof(WeightT) < sizeof(std::int64_t), std::int64_t, Wide>;
+
+    static constexpr std::uint64_t max_weight
+        = std::max<std::uint64_t>(checks::detail::Magnitude(std::numeric_limits<WeightT>::min()),
+                                  std::numeric_limits<WeightT>::max());
+
+    static constexpr std::size_t pass
+        = sizeof(WeightT) < sizeof(std::int64_t)
+              ? static_cast<std::size_t>(std::min<std::uint64_t>(
+                  static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) / max_weight,
+                  std::numeric_limits<std::size_t>::max()))
+              : std::numeric_limits<std::size_t>::max() / 4;
+};
+
+/**
+ * @brief Partial sums of one thread's slice of the keys.
+ */
+template <std::integral WeightT>
+struct HistogramPartial
+{
+    std::vector<typename HistogramTraits<WeightT>::Wide> sums;
+    std::size_t invalid = std::numeric_limits<std::size_t>::max();
+};
+
+/**
+ * @brief Counts keys [first, last) into a partial histogram.
+ *
+ * Consecutive keys go to different sub-histograms, interleaved so that the
+ * sub-bins of a bin share a cache line, which keeps repeated keys from
+ * waiting on each other's stores.
+ *
+ * @tparam Weighted Whether weights are given, otherwise each key counts 1
+ */
+template <bool Weighted, std::integral KeyT, std::integral WeightT>
+void CountSlice(std::span<const KeyT> keys, std::span<const WeightT> weights, std::size_t first,
+                std::size_t last, std::size_t bins, HistogramPartial<WeightT> &partial)
+{
+    using Traits = HistogramTraits<WeightT>;
+    using Acc = typename Traits::Acc;
+
+    constexpr std::size_t ways = 4;
+
+    const auto in_range = [bins](KeyT key)
+    {
+        // Bins can outnumber the values of an unsigned KeyT, so negative keys
+        // are rejected rather than converted
+        return !checks::detail::IsNegative(key) & (static_cast<std::uint64_t>(key) < bins);
+    };
+    const auto bin = [](KeyT key) { return static_cast<std::size_t>(key) * ways; };
+    const auto weight = [&weights](std::size_t i) -> Acc
+    {
+        if constexpr (Weighted)
+            return weights[i];
+        else
+            return 1;
+    };
+
+    partial.sums.assign(bins, 0);
+    std::vector<Acc> sub(bins * ways);
+
+    while (first < last)
+    {
+        const std::size_t end = last - first < Traits::pass ? last : first + Traits::pass;
+        std::size_t i = first;
+
+        for (; end - i >= ways; i += ways)
+        {
+            const KeyT k0 = keys[i];
+            const KeyT k1 = keys[i + 1];
+            const KeyT k2 = keys[i + 2];
+            const KeyT k3 = keys[i + 3];
+
+            if (in_range(k0) & in_range(k1) & in_range(k2) & in_range(k3))
+            {
+                sub[bin(k0)] += weight(i);
+                sub[bin(k1) + 1] += weight(i + 1);
+                sub[bin(k2) + 2] += weight(i + 2);
+                sub[bin(k3) + 3] += weight(i + 3);
+                continue;
+            }
+
+            for (std::size_t j = i; j < i + ways; ++j)
+            {
+                if (in_range(keys[j]))
+                    sub[bin(keys[j]) + (j - i)] += weight(j);
+                else
+                    partial.invalid = std::min(partial.invalid, j);
+            }
+        }
+
+        for (; i < end; ++i)
+        {
+            if (in_range(keys[i]))
+                sub[bin(keys[i])] += weight(i);
+            else
+                partial.invalid = std::min(partial.invalid, i);
+        }
+
+        for (std::size_t b = 0; b < bins; ++b)
+        {
+            for (std::size_t w = 0; w < ways; ++w)
+                partial.sums[b] += sub[b * ways + w];
+        }
+        if (end != last)
+            std::fill(sub.begin(), sub.end(), Acc{0});
+
+        first = end;
+    }
+}
+
+template <std::integral CountT, bool Weighted, std::integral KeyT, std::integral WeightT>
+HistogramResult<CountT> Histogram(std::span<const KeyT> keys, std::span<const WeightT> weights,
+                                  std::size_t bins, const HistogramOptions &options)
+{
+    using Wide = typename HistogramTraits<WeightT>::Wide;
+
+    static_assert(!std::is_void_v<Wide>, "CheckedHistogram needs a 128-bit integer");
+
+    const std::size_t n = keys.size();
+
+    std::size_t threads = options.threads;
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min(threads, n / std::max<std::size_t>(1, options.min_keys_per_thread)));
+
+    std::vector<HistogramPartial<WeightT>> partials(threads);
+    const auto slice = [n, threads](std::size_t t) { return n / threads * t + std::min(t, n % threads); };
+
+    if (threads == 1)
+        CountSlice<Weighted>(keys, weights, 0, n, bins, partials[0]);
+    else
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threads);
+        for (std::size_t t = 0; t < threads; ++t)
+            workers.emplace_back([&, t]
+                                 { CountSlice<Weighted>(keys, weights, slice(t), slice(t + 1), bins, partials[t]); });
+    }
+
+    // Merge, checking each bin once
+    constexpr Wide low = std::is_signed_v<CountT> ? static_cast<Wide>(std::numeric_limits<CountT>::min()) : 0;
+    constexpr Wide high = static_cast<Wide>(std::numeric_limits<CountT>::max());
+
+    HistogramResult<CountT> result{std::vector<IntWrapper<CountT>>(bins), {false, bins}, {false, n}};
+    std::vector<Wide> &totals = partials[0].sums;
+
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+        if (partials[t].invalid < n)
+            result.invalid = {true, std::min(result.invalid.first, partials[t].invalid)};
+        if (t == 0)
+            continue;
+        for (std::size_t b = 0; b < bins; ++b)
+            totals[b] += partials[t].sums[b];
+    }
+
+    unsigned char flag = 0;
+    for (std::size_t b = 0; b < bins; ++b)
+    {
+        flag |= static_cast<unsigned char>((totals[b] < low) | (totals[b] > high));
+        result.counts[b].Get() = static_cast<CountT>(totals[b]);
+    }
+
+    if (flag != 0)
+    {
+        const auto first = std::find_if(totals.begin(), totals.end(),
+                                        [](const Wide &val) { return val < low || val > high; });
+        result.status = {true, static_cast<std::size_t>(first - totals.begin())};
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                              CheckedHistogram                              >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Sums the weight of each key into its bin, like numpy's bincount.
+ *
+ * The keys are split in contiguous slices counted in parallel, each thread
+ * into its own bins, so no bin is shared. The weights are added without
+ * checks to accumulators that can't overflow, and the bins are checked once
+ * each, when the threads' bins are merged. Sums are exact, so a bin that
+ * leaves the range of CountT and comes back isn't an overflow.
+ *
+ * @tparam CountT Integral type of the bins
+ * @tparam KeyT Integral type of the keys
+ * @tparam WeightT Integral type of the weights
+ * @param keys Bin of each event
+ * @param weights Weight of each event
+ * @param bins Number of bins, keys must be in [0, bins)
+ * @param options Threading options
+ * @return The bins and whether any overflowed or any key was outside them
+ * @throw std::invalid_argument If keys and weights have different sizes, which
+ *        aborts if exceptions are disabled
+ */
+template <std::integral CountT = std::int64_t, std::integral KeyT, std::integral WeightT>
+HistogramResult<CountT> CheckedHistogram(std::span<const KeyT> keys, std::span<const WeightT> weights,
+                                         std::size_t bins, const HistogramOptions &options = {})
+{
+    if (keys.size() != weights.size())
+        detail::InvalidArgument("CheckedHistogram: keys and weights have different sizes");
+
+    return detail::Histogram<CountT, true>(keys, weights, bins, options);
+}
+
+/**
+ * @brief Counts the keys in each bin.
+ *
+ * @see CheckedHistogram(std::span<const KeyT>, std::span<const WeightT>, std::size_t, const HistogramOptions&)
+ */
+template <std::integral CountT = std::int64_t, std::integral KeyT>
+HistogramResult<CountT> CheckedHistogram(std::span<const KeyT> keys, std::size_t bins,
+                                         const HistogramOptions &options = {})
+{
+    return detail::Histogram<CountT, false>(keys, std::span<const unsigned char>{}, bins, options);
+}
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_HISTOGRAM_HPP
@@ -0,0 +1,506 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file checked_math.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides overflow-checked integer powers, factorials, binomial
+ *          coefficients, gcd and lcm.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_MATH_HPP
+#define OVERFLOWWRAPPER_INCLUDE_CHECKED_MATH_HPP
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <source_location>
+#include <type_traits>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+// -------------------------------------------------------------------------- >>
+//                                Cutoff tables                               >>
+// -------------------------------------------------------------------------- >>
+
+// Each function looks its arguments up in a table computed at compile time
+// for the result type, and only computes results known to fit, so no
+// operation is checked.
+
+namespace detail
+{
+
+/**
+ * @brief Largest bases whose powers fit in T, by exponent.
+ *
+ * @tparam T Integral type
+ */
+template <std::integral T>
+struct PowRoots
+{
+    using U = std::make_unsigned_t<T>;
+
+    static constexpr unsigned size = std::numeric_limits<U>::digits + 1;
+
+    /**
+     * @brief Largest magnitude whose power is at most the maximum of T.
+     */
+    std::array<U, size> positive{};
+
+    /**
+     * @brief Largest magnitude whose power is at most the magnitude of the
+     *        minimum of T, for negative results.
+     */
+    std::array<U, size> negative{};
+};
+
+/**
+ * @brief Computes the largest b such that b^exp <= limit.
+ */
+template <std::unsigned_integral U>
+constexpr U Root(U limit, unsigned exp)
+{
+    const auto fits = [&](U base)
+    {
+        U pow = 1;
+        for (unsigned i = 0; i < exp; ++i)
+        {
+            if (checks::Mul(pow, base) || wrapping::Mul(pow, base) > limit)
+                return false;
+            pow = wrapping::Mul(pow, base);
+        }
+        return true;
+    };
+
+    constexpr unsigned digits = std::numeric_limits<U>::digits;
+    if (exp == 1)
+        return limit;
+
+    // Invariant: fits(low), !fits(high), since high^exp >= 2^digits
+    U low = 0;
+    U high = static_cast<U>(U{1} << (digits / exp + (digits % exp != 0)));
+
+    while (high - low > 1)
+    {
+        const U mid = static_cast<U>(low + (high - low) / 2);
+        (fits(mid) ? low : high) = mid;
+    }
+    return low;
+}
+
+template <std::integral T>
+inline constexpr PowRoots<T> pow_roots = []
+{
+    using U = std::make_unsigned_t<T>;
+
+    // Every base to the power 0 is 1
+    PowRoots<T> roots;
+    roots.positive[0] = roots.negative[0] = std::numeric_limits<U>::max();
+    for (unsigned exp = 1; exp < PowRoots<T>::size; ++exp)
+    {
+        roots.positive[exp] = Root<U>(std::numeric_limits<T>::max(), exp);
+        roots.negative[exp] = Root<U>(checks::detail::Magnitude(std::numeric_limits<T>::min()), exp);
+    }
+    return roots;
+}();
+
+/**
+ * @brief Factorials that fit in T, 0! to the last one.
+ */
+template <std::integral T>
+inline constexpr auto factorials = []
+{
+    constexpr unsigned count = []
+    {
+        T fact = 1;
+        unsigned n = 1;
+        while (!checks::Mul(fact, n))
+            fact = static_cast<T>(fact * n++);
+        return n;
+    }();
+
+    std::array<T, count> table{};
+    table[0] = 1;
+    for (unsigned n = 1; n < count; ++n)
+        table[n] = static_cast<T>(table[n - 1] * n);
+    return table;
+}();
+
+/**
+ * @brief Computes the binomial coefficient C(n, k), for k <= n - k, by the
+ *        multiplicative formula. Each step computes C(n, i + 1) exactly
+ *        without exceeding it, so nothing overflows if C(n, k) fits.
+ *
+ * @param overflow Set if a step overflows, when building the tables
+ */
+template <std::unsigned_integral U>
+constexpr U Binomial(U n, U k, bool *overflow = nullptr)
+{
+    U result = 1;
+    for (U i = 0; i < k; ++i)
+    {
+        // C(n, i + 1) = C(n, i) * (n - i) / (i + 1), where i + 1 divides the
+        // product and, once g is removed, also n - i
+        const U next = static_cast<U>(i + 1);
+        const U g = std::gcd(result, next);
+        const U factor = static_cast<U>((n - i) / (next / g));
+        if (overflow != nullptr && checks::Mul(static_cast<U>(result / g), factor))
+            *overflow = true;
+        result = wrapping::Mul(static_cast<U>(result / g), factor);
+    }
+    return result;
+}
+
+/**
+ * @brief Largest n whose C(n, k) fits in T, by k. C(n, k) grows with n for
+ *        k <= n / 2, and for every k past the table C(2k, k) doesn't fit.
+ */
+template <std::integral T>
+inline constexpr auto binomial_cutoffs = []
+{
+    using U = std::make_unsigned_t<T>;
+    constexpr U max = std::numeric_limits<T>::max();
+
+    constexpr auto fits = [](U n, U k)
+    {
+        bool overflow = false;
+        const U val = Binomial(n, k, &overflow);
+        return !overflow && val <= max;
+    };
+
+    constexpr std::size_t count = [&]
+    {
+        std::size_t k = 1;
+        while (fits(static_cast<U>(2 * k), static_cast<U>(k)))
+            ++k;
+        return k;
+    }();
+
+    std::array<U, count> table{};
+    table[0] = max;
+    if constexpr (count > 1)
+        table[1] = max;
+    for (std::size_t k = 2; k < count; ++k)
+    {
+        // Invariant: fits(low, k), !fits(high, k)
+        U low = static_cast<U>(2 * k);
+        U high = low;
+        while (fits(high, static_cast<U>(k)))
+        {
+            if (high == max)
+                break;
+            low = high;
+            high = high > max / 2 ? max : static_cast<U>(2 * high);
+        }
+        if (fits(high, static_cast<U>(k)))
+        {
+            table[k] = max;
+            continue;
+        }
+        while (high - low > 1)
+        {
+            const U mid = static_cast<U>(low + (high - low) / 2);
+            (fits(mid, static_cast<U>(k)) ? low : high) = mid;
+        }
+        table[k] = low;
+    }
+    return table;
+}();
+
+} // namespace detail
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                             Non-throwing functions                         >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Raises an integer to a power by squaring, after comparing the base
+ *        against the largest base whose power fits.
+ *
+ * @tparam T Integral type
+ * @param base Base
+ * @param exp Exponent
+ * @return base^exp, wrapped around on Error::Overflow. 0^0 is 1.
+ */
+template <std::integral T>
+[[nodiscard]] constexpr Checked<T> TryPow(const T &base, unsigned exp) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    constexpr auto &roots = detail::pow_roots<T>;
+
+    // Computed modulo 2^N, exact whenever the result fits
+    U result = 1;
+    U square = static_cast<U>(base);
+    for (unsigned e = exp; e != 0; e >>= 1)
+    {
+        if (e & 1)
+            result = wrapping::Mul(result, square);
+        square = wrapping::Mul(square, square);
+    }
+
+    const U magnitude = checks::detail::Magnitude(base);
+    bool overflow = false;
+    if (magnitude > 1)
+    {
+        const bool negative = checks::detail::IsNegative(base) && exp % 2 != 0;
+        overflow = exp >= detail::PowRoots<T>::size
+                   || magnitude > (negative ? roots.negative[exp] : roots.positive[exp]);
+    }
+
+    return {static_cast<T>(result), overflow ? Error::Overflow : Error::None};
+}
+
+/**
+ * @brief Looks up a factorial.
+ *
+ * @tparam T Integral type of the result
+ * @param n Argument
+ * @return n!, 0 on Error::Overflow
+ */
+template <std::integral T>
+[[nodiscard]] constexpr Checked<T> TryFactorial(std::uint64_t n) noexcept
+{
+    constexpr auto &table = detail::factorials<T>;
+    if (n >= table.size())
+        return {0, Error::Overflow};
+    return {table[n], Error::None};
+}
+
+/**
+ * @brief Computes a binomial coefficient, after comparing n against the
+ *        largest n whose coefficient fits for the given k.
+ *
+ * @tparam T Integral type of the result
+ * @param n Number of elements
+ * @param k Number of elements chosen
+ * @return C(n, k), 0 if k > n, and 0 on Error::Overflow
+ */
+template <std::integral T>
+[[nodiscard]] constexpr Checked<T> TryBinomial(std::uint64_t n, std::uint64_t k) noexcept
+{
+    using U = std::make_unsigned_t<T>;
+    constexpr auto &cutoffs = detail::binomial_cutoffs<T>;
+
+    if (k > n)
+        return {0, Error::None};
+    if (k > n - k)
+        k = n - k;
+    if (k == 0)
+        return {1, Error::None};
+
+    if (k >= cutoffs.size() || n > cutoffs[k])
+        return {0, Error::Overflow};
+    return {static_cast<T>(detail::Binomial<U>(static_cast<U>(n), static_cast<U>(k))), Error::None};
+}
+
+/**
+ * @brief Computes the greatest common divisor, like std::gcd, which is
+ *        undefined when it doesn't fit: gcd(min, 0) and gcd(min, min).
+ *
+ * @return gcd(|lhs|, |rhs|) in the common type of both arguments, wrapped
+ *         around on Error::Overflow
+ */
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr Checked<std::common_type_t<LhsT, RhsT>> TryGcd(const LhsT &lhs,
+                                                                       const RhsT &rhs) noexcept
+{
+    using T = std::common_type_t<LhsT, RhsT>;
+    using U = std::make_unsigned_t<T>;
+
+    const U gcd = std::gcd(static_cast<U>(checks::detail::Magnitude(lhs)),
+                           static_cast<U>(checks::detail::Magnitude(rhs)));
+    return {static_cast<T>(gcd), gcd > static_cast<U>(std::numeric_limits<T>::max())
+                                     ? Error::Overflow : Error::None};
+}
+
+/**
+ * @brief Computes the least common multiple, like std::lcm, which is
+ *        undefined when it doesn't fit.
+ *
+ * @return lcm(|lhs|, |rhs|) in the common type of both arguments, 0 if either
+ *         is 0, wrapped around on Error::Overflow
+ */
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr Checked<std::common_type_t<LhsT, RhsT>> TryLcm(const LhsT &lhs,
+                                                                       const RhsT &rhs) noexcept
+{
+    using T = std::common_type_t<LhsT, RhsT>;
+    using U = std::make_unsigned_t<T>;
+
+    const U l = static_cast<U>(checks::detail::Magnitude(lhs));
+    const U r = static_cast<U>(checks::detail::Magnitude(rhs));
+    if (l == 0 || r == 0)
+        return {0, Error::None};
+
+    // l / gcd is exact, only the product can overflow
+    const U quotient = static_cast<U>(l / std::gcd(l, r));
+    const U lcm = wrapping::Mul(quotient, r);
+    return {static_cast<T>(lcm), checks::Mul(quotient, r) || lcm > static_cast<U>(std::numeric_limits<T>::max())
+                                     ? Error::Overflow : Error::None};
+}
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                              Checked functions                             >>
+// -------------------------------------------------------------------------- >>
+
+// Checked without the policy, which is only told about the operation, under
+// its own checks::Operation, and about the overflow or the result.
+
+/**
+ * @brief Raises an integer to a power, see TryPow.
+ *
+ * @tparam Policy Policy told about the overflow and the result
+ * @param where Location reported to the policy
+ */
+template <typename Policy = policy::Default, std::integral T>
+[[nodiscard]] constexpr IntWrapper<T, Policy> CheckedPow(
+    const T &base, unsigned exp, std::source_location where = std::source_location::current())
+{
+    return detail::Commit<Policy, checks::Operation::Pow>(
+        TryPow(base, exp), "Integer overflow in CheckedPow(const T&, unsigned)", where);
+}
+
+/**
+ * @brief Raises a wrapped integer to a power, see TryPow.
+ */
+template <std::integral T, typename Policy>
+[[nodiscard]] constexpr IntWrapper<T, Policy> CheckedPow(
+    const IntWrapper<T, Policy> &base, unsigned exp,
+    std::source_location where = std::source_location::current())
+{
+    return CheckedPow<Policy>(base.Get(), exp, where);
+}
+
+/**
+ * @brief Looks up a factorial, see TryFactorial.
+ *
+ * @tparam T Integral type of the result
+ * @tparam Policy Policy told about the overflow and the result
+ * @param where Location reported to the policy
+ */
+template <std::integral T, typename Policy = policy::Default>
+[[nodiscard]] constexpr IntWrapper<T, Policy> CheckedFactorial(
+    std::uint64_t n, std::source_location where = std::source_location::current())
+{
+    return detail::Commit<Policy, checks::Operation::Factorial>(
+        TryFactorial<T>(n), "Integer overflow in CheckedFactorial<T>(std::uint64_t)", where);
+}
+
+/**
+ * @brief Computes a binomial coefficient, see TryBinomial.
+ *
+ * @tparam T Integral type of the result
+ * @tparam Policy Policy told about the overflow and the result
+ * @param where Location reported to the policy
+ */
+template <std::integral T, typename Policy = policy::Default>
+[[nodiscard]] constexpr IntWrapper<T, Policy> CheckedBinomial(
+    std::uint64_t n, std::uint64_t k, std::source_location where = std::source_location::current())
+{
+    return detail::Commit<Policy, checks::Operation::Binomial>(
+        TryBinomial<T>(n, k), "Integer overflow in CheckedBinomial<T>(std::uint64_t, std::uint64_t)",
+        where);
+}
+
+/**
+ * @brief Computes the greatest common divisor, see TryGcd.
+ *
+ * @tparam Policy Policy told about the overflow and the result
+ * @param where Location reported to the policy
+ */
+template <typename Policy = policy::Default, std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr IntWrapper<std::common_type_t<LhsT, RhsT>, Policy> CheckedGcd(
+    const LhsT &lhs, const RhsT &rhs, std::source_location where = std::source_location::current())
+{
+    return detail::Commit<Policy, checks::Operation::Gcd>(
+        TryGcd(lhs, rhs), "Integer overflow in CheckedGcd(const LhsT&, const RhsT&)", where);
+}
+
+/**
+ * @brief Computes the greatest common divisor of wrapped integers, see TryGcd.
+ */
+template <std::integral T, typename Policy>
+[[nodiscard]] constexpr IntWrapper<T, Policy> CheckedGcd(
+    const IntWrapper<T, Policy> &lhs, const IntWrapper<T, Policy> &rhs,
+    std::source_location where = std::source_location::current())
+{
+    return CheckedGcd<Policy>(lhs.Get(), rhs.Get(), where);
+}
+
+/**
+ * @brief Computes the least common multiple, see TryLcm.
+ *
+ * @tparam Policy Policy told about the overflow and the result
+ * @param where Location reported to the policy
+ */
+template <typename Policy = policy::Default, std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr IntWrapper<std::common_type_t<LhsT, RhsT>, Policy> CheckedLcm(
+    const LhsT &lhs, const RhsT &rhs, std::source_location where = std::source_location::current())
+{
+    return detail::Commit<Policy, checks::Operation::Lcm>(
+        TryLcm(lhs, rhs), "Integer overflow in CheckedLcm(const LhsT&, const RhsT&)", where);
+}
+
+/**
+ * @brief Computes the least common multiple of wrapped integers, see TryLcm.
+ */
+template <std::integral T, typename Policy>
+[[nodiscard]] constexpr IntWrapper<T, Policy> CheckedLcm(
+    const IntWrapper<T, Policy> &lhs, const IntWrapper<T, Policy> &rhs,
+    std::source_location where = std::source_location::current())
+{
+    return CheckedLcm<Policy>(lhs.Get(), rhs.Get(), where);
+}
+
+/**
+ * @brief Computes the midpoint of wrapped integers like std::midpoint, which
+ *        can't overflow, rounding toward lhs.
+ */
+template <std::integral T, typename Policy>
+[[nodiscard]] constexpr IntWrapper<T, Policy> Midpoint(const IntWrapper<T, Policy> &lhs,
+                                                      const IntWrapper<T, Policy> &rhs) noexcept
+{
+    IntWrapper<T, Policy> mid;
+    mid.Get() = std::midpoint(lhs.Get(), rhs.Get());
+    return mid;
+}
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_MATH_HPP
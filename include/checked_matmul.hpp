@@ -0,0 +1,236 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file checked_matmul.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides a checked product of small integer matrices.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_MATMUL_HPP
+#define OVERFLOWWRAPPER_INCLUDE_CHECKED_MATMUL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "checked_column.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+namespace detail
+{
+
+/**
+ * @brief Accumulator types of the product of matrices of T.
+ *
+ * A block of products is summed in Acc, which the loops can widen into
+ * directly, and each block's sums are added to an exact Total. Products of
+ * 32-bit elements don't leave room in a 64-bit Acc, so the right-hand
+ * elements are split in 16-bit halves, each summed separately.
+ */
+template <std::integral T>
+struct MatmulTraits
+{
+    static constexpr bool split = sizeof(T) == 4;
+
+    using Acc = std::conditional_t<sizeof(T) == 1, std::int32_t, std::int64_t>;
+    using Total = std::conditional_t<sizeof(T) == 1, std::int64_t, SumType<std::int64_t>>;
+
+    /**
+     * @brief Largest magnitude of one product summed in Acc.
+     */
+    static constexpr std::uint64_t max_product
+        = std::max<std::uint64_t>(checks::detail::Magnitude(std::numeric_limits<T>::min()),
+                                  std::numeric_limits<T>::max())
+          * (split ? 0x10000u : std::max<std::uint64_t>(checks::detail::Magnitude(std::numeric_limits<T>::min()),
+                                                         std::numeric_limits<T>::max()));
+};
+
+} // namespace detail
+
+// -------------------------------------------------------------------------- >>
+//                                CheckedMatmul                               >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Multiplies two row-major matrices, out = lhs * rhs, checking that
+ *        each element of the product fits in OutT.
+ *
+ * The output is computed in tiles of tile_rows by tile_cols elements. For
+ * each tile, the inner dimension is covered in blocks of tile_depth: the
+ * products of a block are summed into accumulators wide enough for the
+ * whole block, in loops that vectorize, then added to exact totals. Dot
+ * products are exact, so a sum that leaves the range of OutT and comes back
+ * isn't an overflow. The totals of a tile are checked once, without
+ * branches, when it's complete. Like CheckedColumn, every element gets its
+ * result wrapped around the range of OutT.
+ *
+ * @tparam T Integral type of the elements, at most 32 bits
+ * @tparam OutT Integral type of the product's elements, e.g. std::int32_t for
+ *         quantized int8 inputs
+ * @param lhs Left-hand matrix, rows by inner
+ * @param rhs Right-hand matrix, inner by cols
+ * @param out Product, rows by cols
+ * @param rows Number of rows of lhs and out
+ * @param inner Number of columns of lhs and rows of rhs
+ * @param cols Number of columns of rhs and out
+ * @return Whether any element overflowed, and the row-major index of the
+ *         first that did
+ * @throw std::invalid_argument If a span is smaller than its matrix, which
+ *        aborts if exceptions are disabled
+ */
+template <std::integral T, std::integral OutT>
+    requires (sizeof(T) <= 4 && sizeof(OutT) <= 8)
+BatchResult CheckedMatmul(std::span<const T> lhs, std::span<const T> rhs, std::span<OutT> out,
+                          std::size_t rows, std::size_t inner, std::size_t cols)
+{
+    using Traits = detail::MatmulTraits<T>;
+    using Acc = typename Traits::Acc;
+    using Total = typename Traits::Total;
+
+    static_assert(!std::is_void_v<Total>, "CheckedMatmul needs a 128-bit integer for 16- and 32-bit elements");
+
+    constexpr std::size_t tile_rows = 16;
+    constexpr std::size_t tile_cols = 64;
+    constexpr std::size_t tile_depth = 256;
+    constexpr std::size_t tile_size = tile_rows * tile_cols;
+
+    static_assert(Traits::max_product * tile_depth <= static_cast<std::uint64_t>(std::numeric_limits<Acc>::max()),
+                  "A block of products must fit in the accumulator");
+
+    // Bounds of OutT in Total, clamped to Total's range
+    constexpr Total low = std::is_signed_v<OutT> ? static_cast<Total>(std::numeric_limits<OutT>::min()) : 0;
+    constexpr Total high = sizeof(OutT) == sizeof(Total) && std::is_unsigned_v<OutT>
+                               ? static_cast<Total>(std::numeric_limits<std::make_signed_t<OutT>>::max())
+                               : static_cast<Total>(std::numeric_limits<OutT>::max());
+
+    if (checks::Mul(rows, inner) || checks::Mul(inner, cols) || checks::Mul(rows, cols))
+        detail::InvalidArgument("CheckedMatmul: matrix dimensions overflow std::size_t");
+    if (lhs.size() < rows * inner || rhs.size() < inner * cols || out.size() < rows * cols)
+        detail::InvalidArgument("CheckedMatmul: span smaller than its matrix");
+
+    BatchResult result{false, rows * cols};
+
+    std::array<Total, tile_size> total;
+    std::array<Acc, tile_size> acc;
+    std::array<Acc, tile_size> acc_high;
+
+    for (std::size_t i0 = 0; i0 < rows; i0 += tile_rows)
+    {
+        const std::size_t mr = std::min(tile_rows, rows - i0);
+
+        for (std::size_t j0 = 0; j0 < cols; j0 += tile_cols)
+        {
+            const std::size_t nr = std::min(tile_cols, cols - j0);
+            total.fill(0);
+
+            for (std::size_t k0 = 0; k0 < inner; k0 += tile_depth)
+            {
+                const std::size_t kr = std::min(tile_depth, inner - k0);
+                acc.fill(0);
+                if constexpr (Traits::split)
+                    acc_high.fill(0);
+
+                for (std::size_t i = 0; i < mr; ++i)
+                {
+                    const T *a = lhs.data() + (i0 + i) * inner + k0;
+                    Acc *row = acc.data() + i * tile_cols;
+                    Acc *row_high = acc_high.data() + i * tile_cols;
+
+                    for (std::size_t k = 0; k < kr; ++k)
+                    {
+                        const Acc a_ik = a[k];
+                        const T *b = rhs.data() + (k0 + k) * cols + j0;
+
+                        if constexpr (Traits::split)
+                        {
+                            // b = high * 2^16 + low, with low unsigned
+                            for (std::size_t j = 0; j < nr; ++j)
+                            {
+                                row[j] += a_ik * static_cast<Acc>(b[j] & 0xFFFF);
+                                row_high[j] += a_ik * static_cast<Acc>(b[j] >> 16);
+                            }
+                        }
+                        else
+                        {
+                            for (std::size_t j = 0; j < nr; ++j)
+                                row[j] += a_ik * static_cast<Acc>(b[j]);
+                        }
+                    }
+                }
+
+                for (std::size_t x = 0; x < tile_size; ++x)
+                {
+                    if constexpr (Traits::split)
+                        total[x] += static_cast<Total>(acc_high[x]) * 0x10000 + acc[x];
+                    else
+                        total[x] += acc[x];
+                }
+            }
+
+            unsigned char flag = 0;
+            for (std::size_t i = 0; i < mr; ++i)
+            {
+                OutT *dst = out.data() + (i0 + i) * cols + j0;
+                const Total *src = total.data() + i * tile_cols;
+                for (std::size_t j = 0; j < nr; ++j)
+                {
+                    flag |= static_cast<unsigned char>((src[j] < low) | (src[j] > high));
+                    dst[j] = static_cast<OutT>(src[j]);
+                }
+            }
+
+            if (flag == 0)
+                continue;
+
+            // Rescan the tile for its first overflow in row-major order
+            for (std::size_t i = 0; i < mr; ++i)
+            {
+                const Total *src = total.data() + i * tile_cols;
+                const std::size_t j = static_cast<std::size_t>(
+                    std::find_if(src, src + nr, [](const Total &val) { return val < low || val > high; }) - src);
+                if (j != nr)
+                {
+                    result.overflow = true;
+                    result.first = std::min(result.first, (i0 + i) * cols + j0 + j);
+                    break;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_MATMUL_HPP
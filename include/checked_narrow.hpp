@@ -0,0 +1,125 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file checked_narrow.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides checked conversion of whole arrays of integers to another
+ *          integral type.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_NARROW_HPP
+#define OVERFLOWWRAPPER_INCLUDE_CHECKED_NARROW_HPP
+
+#include <cstddef>
+#include <limits>
+#include <span>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+/**
+ * @brief Converts an array of integers to another integral type, stopping at
+ *        the first element that doesn't fit.
+ *
+ * Elements are range-checked a block at a time by comparing the block's
+ * minimum and maximum against the limits of To, reductions the compiler
+ * vectorizes, and the check is skipped entirely when every From fits in To.
+ * Only a block that fails is rechecked element by element. Either side may be
+ * an array of IntWrapper, whose policy isn't involved.
+ *
+ * Deduction doesn't see through conversions to std::span, so containers are
+ * passed with explicit template arguments, e.g.
+ * CheckedNarrow<std::int64_t, std::int32_t>(source, destination).
+ *
+ * @tparam From Source element type
+ * @tparam To Destination element type
+ * @param from Source elements
+ * @param to Destination, at least as long as from
+ * @return from.size() if all elements were converted, otherwise the index of
+ *         the first element that doesn't fit, every element before it being
+ *         converted
+ * @throw std::invalid_argument If to is shorter than from, which aborts if
+ *        exceptions are disabled
+ */
+template <detail::IntegerOrWrapper From, detail::IntegerOrWrapper To>
+std::size_t CheckedNarrow(std::span<const From> from, std::span<To> to)
+{
+    using FromT = detail::RawType<From>;
+    using ToT = detail::RawType<To>;
+    using Limits = std::numeric_limits<ToT>;
+
+    if (to.size() < from.size())
+        detail::InvalidArgument("CheckedNarrow: destination is shorter than source");
+
+    const std::size_t n = from.size();
+    std::size_t i = 0;
+
+    if constexpr (checks::detail::Less(std::numeric_limits<FromT>::min(), Limits::min())
+                  || checks::detail::Less(Limits::max(), std::numeric_limits<FromT>::max()))
+    {
+        constexpr std::size_t block = 64;
+
+        for (; i + block <= n; i += block)
+        {
+            FromT lo = detail::RawRef(from[i]);
+            FromT hi = lo;
+            for (std::size_t j = 1; j < block; ++j)
+            {
+                const FromT val = detail::RawRef(from[i + j]);
+                lo = val < lo ? val : lo;
+                hi = val > hi ? val : hi;
+            }
+
+            if (checks::detail::Less(lo, Limits::min()) || checks::detail::Less(Limits::max(), hi))
+                break;
+
+            for (std::size_t j = 0; j < block; ++j)
+                detail::RawRef(to[i + j]) = static_cast<ToT>(detail::RawRef(from[i + j]));
+        }
+
+        // Tail, or the block that failed
+        for (; i < n; ++i)
+        {
+            if (checks::Assign<ToT>(detail::RawRef(from[i])))
+                return i;
+            detail::RawRef(to[i]) = static_cast<ToT>(detail::RawRef(from[i]));
+        }
+    }
+    else
+    {
+        for (; i < n; ++i)
+            detail::RawRef(to[i]) = static_cast<ToT>(detail::RawRef(from[i]));
+    }
+
+    return n;
+}
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_NARROW_HPP
@@ -0,0 +1,163 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file checked_size.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides checked computation of allocation sizes.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_SIZE_HPP
+#define OVERFLOWWRAPPER_INCLUDE_CHECKED_SIZE_HPP
+
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <source_location>
+#include <type_traits>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+/**
+ * @brief Size of an object or buffer, checked like any IntWrapper.
+ */
+template <typename Policy = policy::Default>
+using BasicCheckedSize = IntWrapper<std::size_t, Policy>;
+
+using CheckedSize = BasicCheckedSize<>;
+
+// -------------------------------------------------------------------------- >>
+//                             Non-throwing helpers                           >>
+// -------------------------------------------------------------------------- >>
+
+// Each helper fuses its operations into one overflow test: a single product
+// in a type twice as wide as std::size_t when there is one, or a single
+// comparison, instead of a division per operation.
+
+/**
+ * @brief Computes the size of a header followed by count elements.
+ *
+ * @param count Number of elements
+ * @param elem_size Size of one element
+ * @param header Size of the header
+ * @return count * elem_size + header, wrapped around on Error::Overflow
+ */
+[[nodiscard]] constexpr Checked<std::size_t> TryAllocBytes(std::size_t count, std::size_t elem_size,
+                                                          std::size_t header = 0) noexcept
+{
+    using Wide = checks::detail::WideUnsigned<2 * sizeof(std::size_t)>;
+    constexpr std::size_t max = std::numeric_limits<std::size_t>::max();
+
+    if constexpr (!std::is_void_v<Wide>)
+    {
+        // Below 2^(2N), the product plus one more N-bit value can't wrap
+        const Wide bytes = static_cast<Wide>(count) * elem_size + header;
+        return {static_cast<std::size_t>(bytes), bytes > max ? Error::Overflow : Error::None};
+    }
+    else
+    {
+        const bool overflow = checks::Mul(count, elem_size) || checks::Sum(count * elem_size, header);
+        return {count * elem_size + header, overflow ? Error::Overflow : Error::None};
+    }
+}
+
+/**
+ * @brief Rounds a size up to a multiple of a power of two.
+ *
+ * @param size Size
+ * @param align Alignment, a power of two
+ * @return The lowest multiple of align not below size, wrapped around on
+ *         Error::Overflow
+ */
+[[nodiscard]] constexpr Checked<std::size_t> TryAlignedSize(std::size_t size,
+                                                           std::size_t align) noexcept
+{
+    const std::size_t mask = align - 1;
+    return {(size + mask) & ~mask,
+            size > std::numeric_limits<std::size_t>::max() - mask ? Error::Overflow : Error::None};
+}
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                               Checked helpers                              >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Computes the size of a header followed by count elements, e.g. for
+ *        malloc or mmap.
+ *
+ * @tparam Policy Policy told about the overflow and the result
+ * @param count Number of elements
+ * @param elem_size Size of one element
+ * @param header Size of the header
+ * @param where Location reported to the policy
+ * @return count * elem_size + header
+ */
+template <typename Policy = policy::Default>
+[[nodiscard]] constexpr BasicCheckedSize<Policy> AllocBytes(
+    std::size_t count, std::size_t elem_size, std::size_t header = 0,
+    std::source_location where = std::source_location::current())
+{
+    return detail::Commit<Policy, checks::Operation::Mul>(
+        TryAllocBytes(count, elem_size, header),
+        "Integer overflow in AllocBytes(std::size_t, std::size_t, std::size_t)", where);
+}
+
+/**
+ * @brief Rounds a size up to a multiple of a power of two.
+ *
+ * @tparam Policy Policy told about the overflow and the result
+ * @param size Size
+ * @param align Alignment, a power of two, or the policy's Overflow is called
+ * @param where Location reported to the policy
+ * @return The lowest multiple of align not below size
+ */
+template <typename Policy = policy::Default>
+[[nodiscard]] constexpr BasicCheckedSize<Policy> AlignedSize(
+    std::size_t size, std::size_t align,
+    std::source_location where = std::source_location::current())
+{
+    // Reported to the policy like an overflow, so that policy::Abort and
+    // builds without exceptions handle it too
+    if (!std::has_single_bit(align))
+        return detail::Commit<Policy, checks::Operation::Sum>(
+            Checked<std::size_t>{size, Error::Overflow},
+            "Invalid alignment in AlignedSize(std::size_t, std::size_t), not a power of two", where);
+
+    return detail::Commit<Policy, checks::Operation::Sum>(
+        TryAlignedSize(size, align),
+        "Integer overflow in AlignedSize(std::size_t, std::size_t)", where);
+}
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_CHECKED_SIZE_HPP
@@ -0,0 +1,509 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file column_aggregator.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides a multithreaded, overflow-checked aggregator of integer
+ *          columns stored in delimited text files.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_COLUMN_AGGREGATOR_HPP
+#define OVERFLOWWRAPPER_INCLUDE_COLUMN_AGGREGATOR_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+// -------------------------------------------------------------------------- >>
+//                                 MappedFile                                 >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Read-only memory mapping of a whole file, advised for sequential
+ *        access.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Maps the file at the given path.
+     *
+     * @param path Path of the file
+     * @throw std::system_error If the file can't be opened or mapped
+     */
+    explicit MappedFile(const std::string &path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+
+        struct stat st{};
+        if (::fstat(fd, &st) == -1)
+        {
+            const int err = errno;
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(), "fstat " + path);
+        }
+
+        size = static_cast<std::size_t>(st.st_size);
+
+        // mmap rejects empty mappings, an empty file is just an empty range
+        if (size != 0)
+        {
+            void *addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED)
+            {
+                const int err = errno;
+                ::close(fd);
+                throw std::system_error(err, std::generic_category(), "mmap " + path);
+            }
+
+            ::madvise(addr, size, MADV_SEQUENTIAL);
+            data = static_cast<const char *>(addr);
+        }
+
+        ::close(fd);
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile()
+    {
+        if (data != nullptr)
+            ::munmap(const_cast<char *>(data), size);
+    }
+
+    /**
+     * @brief Gets the first byte of the mapping.
+     */
+    const char *Begin() const { return data; }
+
+    /**
+     * @brief Gets one past the last byte of the mapping.
+     */
+    const char *End() const { return data + size; }
+
+private:
+    const char *data = nullptr;
+    std::size_t size = 0;
+};
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                              Column aggregation                            >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Checked statistics of one integer column.
+ *
+ * @tparam T Integral type the column is parsed into
+ */
+template <std::integral T>
+struct ColumnStats
+{
+    /**
+     * @brief Number of non-empty values in the column.
+     */
+    IntWrapper<std::uint64_t> count{};
+
+    /**
+     * @brief Sum of the values, up to the row that overflowed if any.
+     */
+    IntWrapper<T> sum{};
+
+    T min = std::numeric_limits<T>::max();
+    T max = std::numeric_limits<T>::min();
+
+    /**
+     * @brief 1-based line of the first value that overflowed either T or the
+     *        running sum, 0 if none did.
+     */
+    std::uint64_t overflow_row = 0;
+
+    /**
+     * @brief 1-based line of the first value that isn't an integer, 0 if
+     *        none. Such values are skipped.
+     */
+    std::uint64_t error_row = 0;
+};
+
+/**
+ * @brief Options of AggregateColumns.
+ */
+struct AggregateOptions
+{
+    /**
+     * @brief Field separator.
+     */
+    char delimiter = ',';
+
+    /**
+     * @brief Whether the first line is a header and must be skipped.
+     */
+    bool header = false;
+
+    /**
+     * @brief Number of worker threads, 0 uses the hardware concurrency.
+     */
+    unsigned threads = 0;
+};
+
+namespace detail
+{
+
+/**
+ * @brief Partial state of one column inside one chunk.
+ *
+ * The running sum of the chunk is tracked together with the lowest and
+ * highest partial sums it went through, so that the sum carried from the
+ * previous chunks can be checked against them with two checks::Sum calls
+ * instead of rescanning the chunk.
+ */
+template <std::integral T>
+struct ColumnPartial
+{
+    std::uint64_t count = 0;
+    T min = std::numeric_limits<T>::max();
+    T max = std::numeric_limits<T>::min();
+
+    T sum = 0;
+    T low = 0;
+    T high = 0;
+    // The local running sum overflowed, the chunk must be rescanned
+    bool rescan = false;
+    // Local line of the first value out of T's range, 0 if none
+    std::uint64_t overflow_line = 0;
+    // Local line of the first non-integer value, 0 if none
+    std::uint64_t error_line = 0;
+};
+
+template <std::integral T>
+struct ChunkPartial
+{
+    const char *begin = nullptr;
+    const char *end = nullptr;
+    std::uint64_t lines = 0;
+    std::vector<ColumnPartial<T>> columns;
+};
+
+enum class FieldStatus
+{
+    Empty,
+    Value,
+    OutOfRange,
+    Invalid
+};
+
+/**
+ * @brief Parses a field as an integer without copying it.
+ *
+ * Surrounding blanks and a leading '+' are accepted.
+ */
+template <std::integral T>
+FieldStatus ParseField(const char *first, const char *last, T &out)
+{
+    while (first != last && (*first == ' ' || *first == '\t'))
+        ++first;
+    while (last != first && (last[-1] == ' ' || last[-1] == '\t' || last[-1] == '\r'))
+        --last;
+
+    if (first == last)
+        return FieldStatus::Empty;
+    if (*first == '+' && last - first > 1 && first[1] != '-')
+        ++first;
+
+    const auto [ptr, ec] = std::from_chars(first, last, out);
+    if (ec == std::errc::result_out_of_range)
+        return FieldStatus::OutOfRange;
+    if (ec != std::errc{} || ptr != last)
+        return FieldStatus::Invalid;
+    return FieldStatus::Value;
+}
+
+/**
+ * @brief Calls fn(line, column, first, last) for every field of every line in
+ *        [begin, end), with line counted from 1.
+ *
+ * @return Number of lines visited
+ */
+template <typename Fn>
+std::uint64_t ForEachField(const char *begin, const char *end, char delimiter,
+                           Fn &&fn)
+{
+    std::uint64_t line = 0;
+
+    while (begin != end)
+    {
+        ++line;
+
+        const char *eol = std::find(begin, end, '\n');
+        std::size_t column = 0;
+        const char *field = begin;
+
+        for (const char *p = begin; ; ++p)
+        {
+            if (p == eol || *p == delimiter)
+            {
+                fn(line, column++, field, p);
+                field = p + 1;
+                if (p == eol)
+                    break;
+            }
+        }
+
+        begin = eol == end ? end : eol + 1;
+    }
+
+    return line;
+}
+
+template <std::integral T>
+void ScanChunk(ChunkPartial<T> &chunk, char delimiter)
+{
+    chunk.lines = ForEachField(
+        chunk.begin, chunk.end, delimiter,
+        [&](std::uint64_t line, std::size_t column, const char *first, const char *last)
+        {
+            T val;
+            const FieldStatus status = ParseField(first, last, val);
+            if (status == FieldStatus::Empty)
+                return;
+
+            if (column >= chunk.columns.size())
+                chunk.columns.resize(column + 1);
+            ColumnPartial<T> &col = chunk.columns[column];
+
+            if (status == FieldStatus::Invalid)
+            {
+                if (col.error_line == 0)
+                    col.error_line = line;
+                return;
+            }
+            if (status == FieldStatus::OutOfRange)
+            {
+                if (col.overflow_line == 0)
+                    col.overflow_line = line;
+                return;
+            }
+
+            ++col.count;
+            col.min = std::min(col.min, val);
+            col.max = std::max(col.max, val);
+
+            // The sum stops at the first overflow, later values can't
+            // contribute to it
+            if (col.rescan || col.overflow_line != 0)
+                return;
+            if (checks::Sum(col.sum, val))
+            {
+                col.rescan = true;
+                return;
+            }
+            col.sum += val;
+            col.low = std::min(col.low, col.sum);
+            col.high = std::max(col.high, col.sum);
+        });
+}
+
+/**
+ * @brief Adds a chunk's values of one column to a sum carried from the
+ *        previous chunks, one value at a time.
+ *
+ * @return Local line of the value that overflowed, 0 if none
+ */
+template <std::integral T>
+std::uint64_t RescanSum(const ChunkPartial<T> &chunk, std::size_t target,
+                        char delimiter, T &sum)
+{
+    std::uint64_t overflow_line = 0;
+
+    ForEachField(
+        chunk.begin, chunk.end, delimiter,
+        [&](std::uint64_t line, std::size_t column, const char *first, const char *last)
+        {
+            if (column != target || overflow_line != 0)
+                return;
+
+            T val;
+            const FieldStatus status = ParseField(first, last, val);
+            if (status == FieldStatus::OutOfRange
+                || (status == FieldStatus::Value && checks::Sum(sum, val)))
+            {
+                overflow_line = line;
+            }
+            else if (status == FieldStatus::Value)
+                sum += val;
+        });
+
+    return overflow_line;
+}
+
+/**
+ * @brief Splits [begin, end) in about n ranges that end at line boundaries.
+ */
+template <std::integral T>
+std::vector<ChunkPartial<T>> SplitChunks(const char *begin, const char *end,
+                                         unsigned n)
+{
+    std::vector<ChunkPartial<T>> chunks;
+    const std::size_t step = static_cast<std::size_t>(end - begin) / n + 1;
+
+    while (begin != end)
+    {
+        const char *cut = end - begin > static_cast<std::ptrdiff_t>(step)
+                              ? begin + step
+                              : end;
+        cut = std::find(cut, end, '\n');
+        if (cut != end)
+            ++cut;
+
+        chunks.push_back({begin, cut, 0, {}});
+        begin = cut;
+    }
+
+    return chunks;
+}
+
+} // namespace detail
+
+/**
+ * @brief Computes the checked count, sum, minimum and maximum of every integer
+ *        column of a delimited text file.
+ *
+ * The file is memory-mapped and split in line-aligned chunks scanned in
+ * parallel. The sums are checked in file order, as if the file had been read
+ * sequentially: a column's sum stops at the first value whose addition
+ * overflows T, or which doesn't fit in T at all, and its line is reported in
+ * ColumnStats::overflow_row.
+ *
+ * @tparam T Integral type the columns are parsed into
+ * @param path Path of the file
+ * @param options Parsing and threading options
+ * @return Statistics of every column, indexed from 0
+ * @throw std::system_error If the file can't be mapped
+ */
+template <std::integral T = long long>
+std::vector<ColumnStats<T>> AggregateColumns(const std::string &path,
+                                             const AggregateOptions &options = {})
+{
+    const MappedFile file{path};
+    const char *begin = file.Begin();
+    const char *end = file.End();
+    std::uint64_t line_offset = 0;
+
+    if (options.header && begin != end)
+    {
+        begin = std::find(begin, end, '\n');
+        if (begin != end)
+            ++begin;
+        line_offset = 1;
+    }
+
+    unsigned threads = options.threads;
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    auto chunks = detail::SplitChunks<T>(begin, end, threads);
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(chunks.size());
+        for (auto &chunk : chunks)
+            workers.emplace_back([&chunk, &options]
+                                 { detail::ScanChunk(chunk, options.delimiter); });
+    }
+
+    // Merge the chunks in file order, carrying the running sums
+    std::vector<ColumnStats<T>> stats;
+    std::vector<T> sums;
+    for (const auto &chunk : chunks)
+    {
+        if (chunk.columns.size() > stats.size())
+        {
+            stats.resize(chunk.columns.size());
+            sums.resize(chunk.columns.size());
+        }
+
+        for (std::size_t c = 0; c < chunk.columns.size(); ++c)
+        {
+            const auto &part = chunk.columns[c];
+            ColumnStats<T> &col = stats[c];
+
+            col.count += part.count;
+            col.min = std::min(col.min, part.min);
+            col.max = std::max(col.max, part.max);
+            if (part.error_line != 0 && col.error_row == 0)
+                col.error_row = line_offset + part.error_line;
+
+            if (col.overflow_row != 0)
+                continue;
+
+            T &sum = sums[c];
+            if (part.rescan || checks::Sum(sum, part.low) || checks::Sum(sum, part.high))
+            {
+                const std::uint64_t line = detail::RescanSum(chunk, c, options.delimiter, sum);
+                if (line != 0)
+                    col.overflow_row = line_offset + line;
+                continue;
+            }
+
+            sum += part.sum;
+            if (part.overflow_line != 0)
+                col.overflow_row = line_offset + part.overflow_line;
+        }
+
+        line_offset += chunk.lines;
+    }
+
+    for (std::size_t c = 0; c < stats.size(); ++c)
+        stats[c].sum = sums[c];
+
+    return stats;
+}
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_COLUMN_AGGREGATOR_HPP
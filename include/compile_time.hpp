@@ -0,0 +1,275 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file compile_time.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides checked arithmetic on constants that fails to compile on
+ *          overflow, and checked integer literals.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_COMPILE_TIME_HPP
+#define OVERFLOWWRAPPER_INCLUDE_COMPILE_TIME_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow::ct
+{
+
+// -------------------------------------------------------------------------- >>
+//                               Constant values                              >>
+// -------------------------------------------------------------------------- >>
+
+// Operands are template arguments, so an overflow fails a static_assert
+// instead of reaching a policy. IntWrapper itself also works in constant
+// expressions, where an overflow is an error for calling the policy's
+// non-constexpr Overflow.
+
+namespace detail
+{
+
+template <checks::Operation O, auto Lhs, auto Rhs>
+    requires std::integral<decltype(Lhs)> && std::integral<decltype(Rhs)>
+consteval decltype(Lhs) Run()
+{
+    static_assert(!checks::Run<O>(Lhs, Rhs), "Integer overflow in constant expression");
+    return wrapping::Run<O>(Lhs, Rhs);
+}
+
+} // namespace detail
+
+/**
+ * @brief Adds two constants.
+ *
+ * @return Lhs + Rhs, in the type of Lhs
+ */
+template <auto Lhs, auto Rhs>
+consteval decltype(Lhs) Add() { return detail::Run<checks::Operation::Sum, Lhs, Rhs>(); }
+
+/**
+ * @brief Subtracts two constants.
+ *
+ * @return Lhs - Rhs, in the type of Lhs
+ */
+template <auto Lhs, auto Rhs>
+consteval decltype(Lhs) Sub() { return detail::Run<checks::Operation::Sub, Lhs, Rhs>(); }
+
+/**
+ * @brief Multiplies two constants.
+ *
+ * @return Lhs * Rhs, in the type of Lhs
+ */
+template <auto Lhs, auto Rhs>
+consteval decltype(Lhs) Mul() { return detail::Run<checks::Operation::Mul, Lhs, Rhs>(); }
+
+/**
+ * @brief Divides two constants.
+ *
+ * @return Lhs / Rhs, in the type of Lhs
+ */
+template <auto Lhs, auto Rhs>
+consteval decltype(Lhs) Div()
+{
+    static_assert(Rhs != 0, "Division by zero in constant expression");
+    return detail::Run<checks::Operation::Div, Lhs, Rhs>();
+}
+
+/**
+ * @brief Shifts a constant to the left.
+ *
+ * @return Lhs << Count, in the type of Lhs
+ */
+template <auto Lhs, auto Count>
+consteval decltype(Lhs) Shl() { return detail::Run<checks::Operation::Shl, Lhs, Count>(); }
+
+/**
+ * @brief Negates a constant.
+ *
+ * @return -Val, in the type of Val
+ */
+template <auto Val>
+consteval decltype(Val) Neg() { return detail::Run<checks::Operation::Neg, Val, 0>(); }
+
+/**
+ * @brief Converts a constant to another integral type.
+ *
+ * @tparam T Destination type
+ * @return Val as T
+ */
+template <std::integral T, auto Val>
+    requires std::integral<decltype(Val)>
+consteval T Cast()
+{
+    static_assert(!checks::Assign<T>(Val), "Integer overflow in constant conversion");
+    return static_cast<T>(Val);
+}
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                                  Literals                                  >>
+// -------------------------------------------------------------------------- >>
+
+namespace detail
+{
+
+/**
+ * @brief Base and prefix length of the characters of an integer literal.
+ */
+struct LiteralBase
+{
+    unsigned base;
+    std::size_t prefix;
+};
+
+consteval LiteralBase FindBase(const char *chars, std::size_t size)
+{
+    if (size > 2 && chars[0] == '0' && (chars[1] == 'x' || chars[1] == 'X'))
+        return {16, 2};
+    if (size > 2 && chars[0] == '0' && (chars[1] == 'b' || chars[1] == 'B'))
+        return {2, 2};
+    if (size > 1 && chars[0] == '0')
+        return {8, 1};
+    return {10, 0};
+}
+
+/**
+ * @brief Value of a digit of a base up to 36, or 36 for any other character.
+ */
+consteval unsigned DigitValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return static_cast<unsigned>(c - '0');
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 10u;
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A' + 10u;
+    return 36;
+}
+
+/**
+ * @brief Whether every character after the prefix is a digit of the base or a
+ *        separator, which rules out floating literals such as 1e3 or 1.5.
+ */
+template <char... Chars>
+consteval bool IsIntegerLiteral()
+{
+    constexpr char chars[] = {Chars...};
+    constexpr LiteralBase base = FindBase(chars, sizeof...(Chars));
+
+    for (std::size_t i = base.prefix; i < sizeof...(Chars); ++i)
+        if (chars[i] != '\'' && DigitValue(chars[i]) >= base.base)
+            return false;
+    return true;
+}
+
+/**
+ * @brief Parses the characters of an integer literal: decimal, hexadecimal,
+ *        octal or binary, with digit separators. Only meaningful if
+ *        IsIntegerLiteral accepts them.
+ */
+template <char... Chars>
+consteval Checked<unsigned long long> ParseLiteral()
+{
+    constexpr char chars[] = {Chars...};
+    constexpr LiteralBase base = FindBase(chars, sizeof...(Chars));
+
+    Checked<unsigned long long> result{0, Error::None};
+    for (std::size_t i = base.prefix; i < sizeof...(Chars); ++i)
+    {
+        const char c = chars[i];
+        if (c == '\'')
+            continue;
+
+        const unsigned digit = DigitValue(c);
+        if (checks::Mul(result.value, base.base) || checks::Sum(result.value * base.base, digit))
+            result.error = Error::Overflow;
+        result.value = result.value * base.base + digit;
+    }
+
+    return result;
+}
+
+template <std::integral T, char... Chars>
+consteval IntWrapper<T> Literal()
+{
+    constexpr bool valid = IsIntegerLiteral<Chars...>();
+    static_assert(valid, "Not an integer literal: every character must be a digit "
+                         "of its base or a separator, floating literals aren't accepted");
+
+    constexpr Checked<unsigned long long> parsed = ParseLiteral<Chars...>();
+    static_assert(!valid || (parsed.Ok() && !checks::Assign<T>(parsed.value)),
+                  "Integer literal out of range");
+    return IntWrapper<T>(static_cast<T>(parsed.value));
+}
+
+} // namespace detail
+
+} // namespace overflow::ct
+
+
+
+
+
+namespace overflow::literals
+{
+
+// Literals are non-negative, so e.g. -128_i8 negates 128, which doesn't fit,
+// like it would for any other literal of a signed type.
+
+template <char... Chars>
+consteval IntWrapper<std::int8_t> operator""_i8() { return ct::detail::Literal<std::int8_t, Chars...>(); }
+
+template <char... Chars>
+consteval IntWrapper<std::int16_t> operator""_i16() { return ct::detail::Literal<std::int16_t, Chars...>(); }
+
+template <char... Chars>
+consteval IntWrapper<std::int32_t> operator""_i32() { return ct::detail::Literal<std::int32_t, Chars...>(); }
+
+template <char... Chars>
+consteval IntWrapper<std::int64_t> operator""_i64() { return ct::detail::Literal<std::int64_t, Chars...>(); }
+
+template <char... Chars>
+consteval IntWrapper<std::uint8_t> operator""_u8() { return ct::detail::Literal<std::uint8_t, Chars...>(); }
+
+template <char... Chars>
+consteval IntWrapper<std::uint16_t> operator""_u16() { return ct::detail::Literal<std::uint16_t, Chars...>(); }
+
+template <char... Chars>
+consteval IntWrapper<std::uint32_t> operator""_u32() { return ct::detail::Literal<std::uint32_t, Chars...>(); }
+
+template <char... Chars>
+consteval IntWrapper<std::uint64_t> operator""_u64() { return ct::detail::Literal<std::uint64_t, Chars...>(); }
+
+} // namespace overflow::literals
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_COMPILE_TIME_HPP
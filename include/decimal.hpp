@@ -0,0 +1,505 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file decimal.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides an overflow-checked decimal fixed-point type, e.g. for
+ *          amounts of money.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_DECIMAL_HPP
+#define OVERFLOWWRAPPER_INCLUDE_DECIMAL_HPP
+
+#include <compare>
+#include <concepts>
+#include <limits>
+#include <ostream>
+#include <source_location>
+#include <type_traits>
+
+#include "intwrapper.hpp"
+#include "../src/digits.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+// -------------------------------------------------------------------------- >>
+//                                  Rounding                                  >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief How results with more decimal places than the scale are rounded.
+ */
+enum class Rounding
+{
+    /**
+     * @brief Truncates, like integer division.
+     */
+    TowardZero,
+
+    /**
+     * @brief Rounds toward negative infinity.
+     */
+    Floor,
+
+    /**
+     * @brief Rounds toward positive infinity.
+     */
+    Ceiling,
+
+    /**
+     * @brief Rounds to the nearest, halves away from zero.
+     */
+    HalfUp,
+
+    /**
+     * @brief Rounds to the nearest, halves to the even neighbour (banker's
+     *        rounding).
+     */
+    HalfEven
+};
+
+namespace detail
+{
+
+/**
+ * @brief Divides magnitudes and rounds the quotient of a value of the given
+ *        sign. U is unsigned, possibly a 128-bit type std::unsigned_integral
+ *        doesn't accept.
+ */
+template <typename U>
+constexpr U DivideRounded(const U &num, const U &den, bool negative, Rounding rounding)
+{
+    const U quotient = num / den;
+    const U remainder = num % den;
+    if (remainder == 0)
+        return quotient;
+
+    // remainder < den, so twice it can't wrap in a type twice as wide as den
+    switch (rounding)
+    {
+    case Rounding::TowardZero: return quotient;
+    case Rounding::Floor: return quotient + negative;
+    case Rounding::Ceiling: return quotient + !negative;
+    case Rounding::HalfUp: return quotient + (remainder >= den - remainder);
+    case Rounding::HalfEven:
+        return quotient + (remainder > den - remainder
+                           || (remainder == den - remainder && quotient % 2 != 0));
+    }
+    return quotient;
+}
+
+/**
+ * @brief Checked compound assignments of a Decimal by one integral type. Sums
+ *        and differences convert the integer to a Decimal, products and
+ *        quotients use it as it is, like Mul and Div.
+ *
+ * @tparam DecimalT Decimal type
+ * @tparam RhsT Right-hand argument's integral type
+ */
+template <typename DecimalT, std::integral RhsT>
+class DecimalAssignment
+{
+public:
+    constexpr DecimalT &operator+=(const Operand<RhsT> &rhs)
+    {
+        return Self().Add(DecimalT(rhs.value, rhs.where), rhs.where);
+    }
+
+    constexpr DecimalT &operator-=(const Operand<RhsT> &rhs)
+    {
+        return Self().Sub(DecimalT(rhs.value, rhs.where), rhs.where);
+    }
+
+    constexpr DecimalT &operator*=(const Operand<RhsT> &rhs) { return Self().Mul(rhs.value, rhs.where); }
+
+    constexpr DecimalT &operator/=(const Operand<RhsT> &rhs)
+    {
+        return Self().Div(rhs.value, Rounding::HalfEven, rhs.where);
+    }
+
+private:
+    constexpr DecimalT &Self() { return static_cast<DecimalT &>(*this); }
+};
+
+/**
+ * @brief Combines the compound assignments of a Decimal by several integral
+ *        types.
+ */
+template <typename DecimalT, std::integral... RhsTs>
+class DecimalAssignments : public DecimalAssignment<DecimalT, RhsTs>...
+{
+public:
+    using DecimalAssignment<DecimalT, RhsTs>::operator+=...;
+    using DecimalAssignment<DecimalT, RhsTs>::operator-=...;
+    using DecimalAssignment<DecimalT, RhsTs>::operator*=...;
+    using DecimalAssignment<DecimalT, RhsTs>::operator/=...;
+};
+
+} // namespace detail
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                                   Decimal                                  >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Decimal fixed-point number stored as an integer count of units of
+ *        10^-Scale, e.g. cents with a Scale of 2.
+ *
+ * Addition and subtraction are the checked operations of the count.
+ * Multiplication and division compute the exact product or scaled dividend
+ * in an unsigned type twice as wide as T, round once, and check that the
+ * result fits, so no precision is lost to an intermediate rescale. Factors
+ * depending on the scale only, like the range of integers that convert
+ * without overflow, are computed at compile time.
+ *
+ * Like those of IntWrapper, the operators report the location of their caller
+ * to the policy.
+ *
+ * @tparam T Integral type of the count
+ * @tparam Scale Number of decimal places
+ * @tparam Policy Overflow policy of the count
+ */
+template <std::integral T, unsigned Scale, typename Policy = policy::Default>
+class Decimal : public detail::ForStandardIntegers<detail::DecimalAssignments, Decimal<T, Scale, Policy>>
+{
+public:
+    using value_type = T;
+    using policy_type = Policy;
+
+    static_assert(Scale <= static_cast<unsigned>(std::numeric_limits<T>::digits10),
+                  "10^Scale must fit in T");
+
+    /**
+     * @brief Count of one, 10^Scale.
+     */
+    static constexpr T factor = static_cast<T>(digits::powers[Scale]);
+
+    /**
+     * @brief Initializes the number as zero.
+     */
+    constexpr Decimal() = default;
+
+    /**
+     * @brief Initializes the number with an integer.
+     *
+     * @tparam ArgT Argument's integral type
+     * @param whole Integral value
+     * @param where Location reported to the policy
+     */
+    template <std::integral ArgT>
+    constexpr Decimal(const ArgT &whole,
+                      std::source_location where = std::source_location::current())
+        : units(whole, where)
+    {
+        constexpr checks::Range<T> range = checks::MulRange<T>(factor);
+
+        Policy::Bypass(checks::Operation::Mul, where);
+        if (!range.Contains(units.Get()))
+            Policy::Overflow("Integer overflow in Decimal<T, Scale>::Decimal<ArgT>(const ArgT&)", where);
+        units.Get() *= factor;
+        Policy::Result(checks::Operation::Mul, units.Get(), where);
+    }
+
+    /**
+     * @brief Creates a number from its count of units of 10^-Scale.
+     */
+    static constexpr Decimal FromUnits(const IntWrapper<T, Policy> &units)
+    {
+        Decimal result;
+        result.units = units;
+        return result;
+    }
+
+    /**
+     * @brief Gets the count of units of 10^-Scale.
+     */
+    [[nodiscard]] constexpr const IntWrapper<T, Policy> &Units() const { return units; }
+
+    /**
+     * @brief Gets the integral part, truncated toward zero.
+     */
+    [[nodiscard]] constexpr T Whole() const { return units.Get() / factor; }
+
+    /**
+     * @brief Gets the fractional part as a count of units, with the sign of
+     *        the number.
+     */
+    [[nodiscard]] constexpr T Fraction() const { return units.Get() % factor; }
+
+
+
+    /**
+     * @brief Converts the number to another scale.
+     *
+     * @tparam NewScale Number of decimal places of the result
+     * @param rounding How places that are dropped round
+     * @param where Location reported to the policy
+     * @return The number with NewScale places
+     */
+    template <unsigned NewScale>
+    [[nodiscard]] constexpr Decimal<T, NewScale, Policy> Rescale(
+        Rounding rounding = Rounding::HalfEven,
+        std::source_location where = std::source_location::current()) const
+    {
+        using Result = Decimal<T, NewScale, Policy>;
+
+        if constexpr (NewScale >= Scale)
+        {
+            constexpr T up = static_cast<T>(digits::powers[NewScale - Scale]);
+            constexpr checks::Range<T> range = checks::MulRange<T>(up);
+
+            Policy::Bypass(checks::Operation::Mul, where);
+            if (!range.Contains(units.Get()))
+                Policy::Overflow("Integer overflow in Decimal<T, Scale>::Rescale<NewScale>()", where);
+            Policy::Result(checks::Operation::Mul, static_cast<T>(units.Get() * up), where);
+            return Result::FromUnits(static_cast<T>(units.Get() * up));
+        }
+        else
+        {
+            // Only shrinks, can't overflow
+            using U = std::make_unsigned_t<T>;
+            const bool negative = checks::detail::IsNegative(units.Get());
+            const U magnitude = detail::DivideRounded<U>(
+                checks::detail::Magnitude(units.Get()),
+                static_cast<U>(digits::powers[Scale - NewScale]), negative, rounding);
+            return Result::FromUnits(negative ? wrapping::Sub(T{0}, magnitude)
+                                              : static_cast<T>(magnitude));
+        }
+    }
+
+
+
+    constexpr Decimal &Add(const Decimal &rhs,
+                           std::source_location where = std::source_location::current())
+    {
+        units.Add(rhs.units.Get(), where);
+        return *this;
+    }
+
+    constexpr Decimal &Sub(const Decimal &rhs,
+                           std::source_location where = std::source_location::current())
+    {
+        units.Sub(rhs.units.Get(), where);
+        return *this;
+    }
+
+    /**
+     * @brief Multiplies the number by another, rounding the exact product
+     *        once.
+     *
+     * @param rhs Multiplier
+     * @param rounding How places beyond the scale round
+     * @param where Location reported to the policy
+     * @return Reference to self
+     */
+    constexpr Decimal &Mul(const Decimal &rhs, Rounding rounding = Rounding::HalfEven,
+                           std::source_location where = std::source_location::current())
+    {
+        const Wide product = static_cast<Wide>(checks::detail::Magnitude(units.Get()))
+                             * checks::detail::Magnitude(rhs.units.Get());
+        return Store(product, static_cast<Wide>(factor),
+                     checks::detail::IsNegative(units.Get()) != checks::detail::IsNegative(rhs.units.Get()),
+                     rounding, checks::Operation::Mul,
+                     "Integer overflow in Decimal<T, Scale>::Mul(const Decimal&)", where);
+    }
+
+    /**
+     * @brief Multiplies the number by an integer, exactly.
+     */
+    template <std::integral RhsT>
+    constexpr Decimal &Mul(const RhsT &rhs,
+                           std::source_location where = std::source_location::current())
+    {
+        units.Mul(rhs, where);
+        return *this;
+    }
+
+    /**
+     * @brief Divides the number by another, rounding the exact quotient once.
+     *
+     * @param rhs Divisor, division by zero is reported to the policy as an
+     *        overflow
+     * @param rounding How places beyond the scale round
+     * @param where Location reported to the policy
+     * @return Reference to self
+     */
+    constexpr Decimal &Div(const Decimal &rhs, Rounding rounding = Rounding::HalfEven,
+                           std::source_location where = std::source_location::current())
+    {
+        if (rhs.units.Get() == 0)
+        {
+            Policy::Bypass(checks::Operation::Div, where);
+            Policy::Overflow("Division by zero in Decimal<T, Scale>::Div(const Decimal&)", where);
+        }
+
+        const Wide dividend = static_cast<Wide>(checks::detail::Magnitude(units.Get())) * factor;
+        return Store(dividend, static_cast<Wide>(checks::detail::Magnitude(rhs.units.Get())),
+                     checks::detail::IsNegative(units.Get()) != checks::detail::IsNegative(rhs.units.Get()),
+                     rounding, checks::Operation::Div,
+                     "Integer overflow in Decimal<T, Scale>::Div(const Decimal&)", where);
+    }
+
+    /**
+     * @brief Divides the number by an integer, rounding once. The count is
+     *        divided directly, so any divisor of RhsT is accepted.
+     */
+    template <std::integral RhsT>
+    constexpr Decimal &Div(const RhsT &rhs, Rounding rounding = Rounding::HalfEven,
+                           std::source_location where = std::source_location::current())
+    {
+        using U = std::conditional_t<(sizeof(RhsT) > sizeof(Wide)), std::make_unsigned_t<RhsT>, Wide>;
+
+        if (rhs == 0)
+        {
+            Policy::Bypass(checks::Operation::Div, where);
+            Policy::Overflow("Division by zero in Decimal<T, Scale>::Div<RhsT>(const RhsT&)", where);
+        }
+
+        return Store<U>(checks::detail::Magnitude(units.Get()), checks::detail::Magnitude(rhs),
+                        checks::detail::IsNegative(units.Get()) != checks::detail::IsNegative(rhs),
+                        rounding, checks::Operation::Div,
+                        "Integer overflow in Decimal<T, Scale>::Div<RhsT>(const RhsT&)", where);
+    }
+
+
+
+    using detail::ForStandardIntegers<detail::DecimalAssignments, Decimal>::operator+=;
+    using detail::ForStandardIntegers<detail::DecimalAssignments, Decimal>::operator-=;
+    using detail::ForStandardIntegers<detail::DecimalAssignments, Decimal>::operator*=;
+    using detail::ForStandardIntegers<detail::DecimalAssignments, Decimal>::operator/=;
+
+    constexpr Decimal &operator+=(detail::Target<const Decimal> rhs) { return Add(rhs.ref, rhs.where); }
+
+    constexpr Decimal &operator-=(detail::Target<const Decimal> rhs) { return Sub(rhs.ref, rhs.where); }
+
+    constexpr Decimal &operator*=(detail::Target<const Decimal> rhs)
+    {
+        return Mul(rhs.ref, Rounding::HalfEven, rhs.where);
+    }
+
+    constexpr Decimal &operator/=(detail::Target<const Decimal> rhs)
+    {
+        return Div(rhs.ref, Rounding::HalfEven, rhs.where);
+    }
+
+    friend constexpr Decimal operator-(detail::Target<const Decimal> operand)
+    {
+        Decimal result = operand.ref;
+        result.units.Negate(operand.where);
+        return result;
+    }
+
+    constexpr Decimal operator+() const { return *this; }
+
+    friend constexpr Decimal operator+(Decimal lhs, const Decimal &rhs) { return lhs += rhs; }
+
+    friend constexpr Decimal operator-(Decimal lhs, const Decimal &rhs) { return lhs -= rhs; }
+
+    friend constexpr Decimal operator*(Decimal lhs, const Decimal &rhs) { return lhs *= rhs; }
+
+    friend constexpr Decimal operator/(Decimal lhs, const Decimal &rhs) { return lhs /= rhs; }
+
+    friend constexpr bool operator==(const Decimal &lhs, const Decimal &rhs)
+    {
+        return lhs.units.Get() == rhs.units.Get();
+    }
+
+    friend constexpr auto operator<=>(const Decimal &lhs, const Decimal &rhs)
+    {
+        return lhs.units.Get() <=> rhs.units.Get();
+    }
+
+    /**
+     * @brief Writes the number with exactly Scale decimal places.
+     */
+    friend std::ostream &operator<<(std::ostream &os, const Decimal &d)
+    {
+        using U = std::make_unsigned_t<T>;
+
+        const U magnitude = checks::detail::Magnitude(d.units.Get());
+        const U whole = magnitude / static_cast<U>(factor);
+        const U fraction = magnitude % static_cast<U>(factor);
+
+        char buffer[digits::max_chars<T> + Scale + 2];
+        char *last = buffer + sizeof(buffer);
+        char *first = last;
+
+        if constexpr (Scale > 0)
+        {
+            first -= Scale;
+            for (char *p = first; p != last; ++p)
+                *p = '0';
+            digits::Write(last, fraction);
+            *--first = '.';
+        }
+        digits::Write(first, whole);
+        first -= digits::Count(whole);
+        if (checks::detail::IsNegative(d.units.Get()))
+            *--first = '-';
+
+        return os.write(first, last - first);
+    }
+
+private:
+    using Wide = checks::detail::WideUnsigned<2 * sizeof(T)>;
+
+    static_assert(!std::is_void_v<Wide>, "Decimal needs an unsigned type twice as wide as T");
+
+    /**
+     * @brief Rounds num / den into the count, checking that it fits. U is
+     *        unsigned and at least as wide as T.
+     */
+    template <typename U>
+    constexpr Decimal &Store(const U &num, const U &den, bool negative, Rounding rounding,
+                             checks::Operation o, const char *what,
+                             const std::source_location &where)
+    {
+        const U magnitude = detail::DivideRounded<U>(num, den, negative, rounding);
+        const U limit = negative ? checks::detail::Magnitude(std::numeric_limits<T>::min())
+                                    : static_cast<std::make_unsigned_t<T>>(std::numeric_limits<T>::max());
+
+        Policy::Bypass(o, where);
+        if (magnitude > limit)
+            Policy::Overflow(what, where);
+
+        const auto narrow = static_cast<std::make_unsigned_t<T>>(magnitude);
+        units.Get() = negative ? wrapping::Sub(T{0}, narrow) : static_cast<T>(narrow);
+        Policy::Result(o, units.Get(), where);
+        return *this;
+    }
+
+    IntWrapper<T, Policy> units;
+};
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_DECIMAL_HPP
@@ -0,0 +1,285 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file headroom.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides an overflow policy that records a histogram of how close
+ *          results come to the limits of their types.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_HEADROOM_HPP
+#define OVERFLOWWRAPPER_INCLUDE_HEADROOM_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow::headroom
+{
+
+// -------------------------------------------------------------------------- >>
+//                                 Public API                                 >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Results of all threads bucketed by checks::HeadroomBits, for one
+ *        wrapped type.
+ */
+struct Histogram
+{
+    /**
+     * @brief Name of the wrapped type, such as "int64", "uint8" or "bool".
+     */
+    std::string type;
+
+    /**
+     * @brief Value bits of the wrapped type, std::numeric_limits<T>::digits.
+     */
+    int digits = 0;
+
+    /**
+     * @brief Whether the wrapped type has a sign bit.
+     */
+    bool is_signed = false;
+
+    /**
+     * @brief Number of results per headroom, indexed from 0 to digits.
+     */
+    std::vector<std::uint64_t> buckets;
+
+    /**
+     * @brief Gets the narrowest width, sign included, that every recorded
+     *        result fits in.
+     *
+     * @return Width in bits, 0 if nothing was recorded
+     */
+    [[nodiscard]] int RequiredBits() const
+    {
+        for (int headroom = 0; headroom <= digits; ++headroom)
+            if (buckets[headroom] != 0)
+                return digits - headroom + is_signed;
+        return 0;
+    }
+};
+
+namespace detail
+{
+
+/**
+ * @brief One thread's buckets for one wrapped type. Only the owning thread
+ *        writes.
+ */
+struct Counts
+{
+    std::string type;
+    int digits = 0;
+    bool is_signed = false;
+    std::array<std::atomic<std::uint64_t>, 65> buckets{};
+};
+
+/**
+ * @brief Keeps the counts of all threads alive until they're collected.
+ */
+class Registry
+{
+public:
+    static Registry &Instance()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    std::shared_ptr<Counts> Register(std::string type, int digits, bool is_signed)
+    {
+        auto counts = std::make_shared<Counts>();
+        counts->type = std::move(type);
+        counts->digits = digits;
+        counts->is_signed = is_signed;
+
+        const std::lock_guard lock{mutex};
+        all.push_back(counts);
+        return counts;
+    }
+
+    std::vector<std::shared_ptr<Counts>> Snapshot()
+    {
+        const std::lock_guard lock{mutex};
+        return all;
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Counts>> all;
+};
+
+/**
+ * @brief Names a type by signedness and width, except bool, which would
+ *        otherwise share the name of the 8-bit unsigned type.
+ */
+template <std::integral T>
+std::string TypeName()
+{
+    if constexpr (std::is_same_v<T, bool>)
+        return "bool";
+    else
+        return (std::is_signed_v<T> ? "int" : "uint")
+               + std::to_string(sizeof(T) * std::numeric_limits<unsigned char>::digits);
+}
+
+/**
+ * @brief Gets the calling thread's counts for T, creating them on first use.
+ */
+template <std::integral T>
+Counts &ThreadCounts()
+{
+    thread_local constinit Counts *counts = nullptr;
+
+    if (counts == nullptr) [[unlikely]]
+    {
+        thread_local const std::shared_ptr<Counts> owner
+            = Registry::Instance().Register(TypeName<T>(), std::numeric_limits<T>::digits,
+                                            std::is_signed_v<T>);
+        counts = owner.get();
+    }
+
+    return *counts;
+}
+
+} // namespace detail
+
+/**
+ * @brief Sums the histograms of every thread.
+ *
+ * Reading doesn't block the instrumented threads, so results recorded
+ * concurrently may or may not be included.
+ *
+ * @return One histogram per wrapped type, sorted by type name
+ */
+inline std::vector<Histogram> Collect()
+{
+    std::map<std::string, Histogram> merged;
+
+    for (const auto &counts : detail::Registry::Instance().Snapshot())
+    {
+        Histogram &h = merged[counts->type];
+        h.type = counts->type;
+        h.digits = counts->digits;
+        h.is_signed = counts->is_signed;
+        h.buckets.resize(counts->digits + 1);
+
+        for (int i = 0; i <= counts->digits; ++i)
+            h.buckets[i] += counts->buckets[i].load(std::memory_order_relaxed);
+    }
+
+    std::vector<Histogram> histograms;
+    for (auto &[type, h] : merged)
+        histograms.push_back(std::move(h));
+    return histograms;
+}
+
+/**
+ * @brief Writes the non-empty buckets of every histogram as CSV with a header
+ *        line.
+ */
+inline void WriteCsv(std::ostream &os)
+{
+    os << "type,headroom_bits,count\n";
+    for (const Histogram &h : Collect())
+        for (int i = 0; i <= h.digits; ++i)
+            if (h.buckets[i] != 0)
+                os << h.type << ',' << i << ',' << h.buckets[i] << '\n';
+}
+
+} // namespace overflow::headroom
+
+
+
+
+
+namespace overflow::policy
+{
+
+// -------------------------------------------------------------------------- >>
+//                                  Headroom                                  >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Records checks::HeadroomBits of every result in per-thread histograms,
+ *        one per wrapped type. Constant evaluation isn't recorded.
+ *
+ * @tparam Base Policy the checks and overflows are forwarded to
+ */
+template <typename Base = Default>
+struct Headroom
+{
+    template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+    [[nodiscard]] static constexpr bool Check(const LhsT &lhs, const RhsT &rhs,
+                                              const std::source_location &where)
+    {
+        return Base::template Check<O>(lhs, rhs, where);
+    }
+
+    static constexpr void Bypass(checks::Operation o, const std::source_location &where)
+    {
+        Base::Bypass(o, where);
+    }
+
+    template <std::integral T>
+    static constexpr void Result(checks::Operation o, const T &result,
+                                 const std::source_location &where)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            auto &bucket = headroom::detail::ThreadCounts<T>().buckets[checks::HeadroomBits(result)];
+            bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        Base::Result(o, result, where);
+    }
+
+    [[noreturn]] static void Overflow(const char *what,
+                                      const std::source_location &where)
+    {
+        Base::Overflow(what, where);
+    }
+};
+
+} // namespace overflow::policy
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_HEADROOM_HPP
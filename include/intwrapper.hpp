@@ -30,9 +30,14 @@
 #ifndef OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_HPP
 #define OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_HPP
 
-#include <stdexcept>
+#include <limits>
+#include <source_location>
+#include <type_traits>
 
+#include "../src/checked.hpp"
 #include "../src/overflow_checks.hpp"
+#include "../src/policy.hpp"
+#include "../src/wrapping.hpp"
 
 
 
@@ -41,6 +46,229 @@
 namespace overflow
 {
 
+template <std::integral T = int, typename Policy = policy::Default>
+class IntWrapper;
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                                  Operands                                  >>
+// -------------------------------------------------------------------------- >>
+
+// Operators can't take a defaulted std::source_location, so the operands of
+// the checked compound assignments and increments record the caller's
+// location when they're converted, like the named operations do.
+
+namespace detail
+{
+
+/**
+ * @brief Right-hand operand of a checked compound assignment.
+ *
+ * @tparam T Operand's integral type
+ */
+template <std::integral T>
+struct Operand
+{
+    /**
+     * @brief Records an integer of exactly T, so that only one Operand of the
+     *        compound assignments matches.
+     *
+     * @param val Integral operand
+     * @param where Location of the caller
+     */
+    template <std::same_as<T> ArgT>
+    constexpr Operand(const ArgT &val,
+                      std::source_location where = std::source_location::current()) noexcept
+        : value{val}, where{where}
+    {
+    }
+
+    /**
+     * @brief Records the value of a wrapper of T.
+     *
+     * @tparam ArgPolicy Argument's policy
+     * @param val Integer wrapper
+     * @param where Location of the caller
+     */
+    template <typename ArgPolicy>
+    constexpr Operand(const IntWrapper<T, ArgPolicy> &val,
+                      std::source_location where = std::source_location::current()) noexcept
+        : value{val.Get()}, where{where}
+    {
+    }
+
+    T value;
+    std::source_location where;
+};
+
+/**
+ * @brief Operand taken by reference: the wrapper of the increment and
+ *        decrement operators, or a const number of the operators of Decimal
+ *        and Rational.
+ *
+ * @tparam Wrapper Integer wrapper or number type
+ */
+template <typename Wrapper>
+struct Target
+{
+    /**
+     * @brief Records the operand.
+     *
+     * @param ref Operand
+     * @param where Location of the caller
+     */
+    constexpr Target(Wrapper &ref,
+                     std::source_location where = std::source_location::current()) noexcept
+        : ref{ref}, where{where}
+    {
+    }
+
+    Wrapper &ref;
+    std::source_location where;
+};
+
+/**
+ * @brief Free arithmetic operators, computed in a wrapper of C with Policy.
+ *
+ * @tparam C Common integral type of the operands
+ * @tparam Policy Policy of the result
+ */
+template <std::integral C, typename Policy>
+struct BinaryOperation;
+
+/**
+ * @brief Checked compound assignments of a wrapper by one right-hand type.
+ *        Not templates, so that the operand converts to Operand.
+ *
+ * @tparam Derived Integer wrapper
+ * @tparam RhsT Right-hand argument's integral type
+ */
+template <typename Derived, std::integral RhsT>
+class CompoundAssignment
+{
+public:
+    /**
+     * @brief Adds an integer or wrapped integer to the object's value.
+     *
+     * @param rhs Integral operand
+     * @return Reference to self
+     */
+    constexpr Derived &operator+=(const Operand<RhsT> &rhs)
+    {
+        return Self().template Apply<checks::Operation::Sum>(
+            rhs.value, "Integer overflow in IntWrapper<T>::operator+=(const value_type&)", rhs.where);
+    }
+
+    /**
+     * @brief Subtracts an integer or wrapped integer from the object's value.
+     *
+     * @param rhs Integral operand
+     * @return Reference to self
+     */
+    constexpr Derived &operator-=(const Operand<RhsT> &rhs)
+    {
+        return Self().template Apply<checks::Operation::Sub>(
+            rhs.value, "Integer overflow in IntWrapper<T>::operator-=(const value_type&)", rhs.where);
+    }
+
+    /**
+     * @brief Multiplies the object's value by an integer or wrapped integer.
+     *
+     * @param rhs Integral operand
+     * @return Reference to self
+     */
+    constexpr Derived &operator*=(const Operand<RhsT> &rhs)
+    {
+        return Self().template Apply<checks::Operation::Mul>(
+            rhs.value, "Integer overflow in IntWrapper<T>::operator*=(const value_type&)", rhs.where);
+    }
+
+    /**
+     * @brief Divides the object's value by an integer or wrapped integer.
+     *
+     * @param rhs Integral operand
+     * @return Reference to self
+     */
+    constexpr Derived &operator/=(const Operand<RhsT> &rhs)
+    {
+        return Self().template Apply<checks::Operation::Div>(
+            rhs.value, "Integer overflow in IntWrapper<T>::operator/=(const value_type&)", rhs.where);
+    }
+
+    /**
+     * @brief Bitwise left shift of the object's value and an integer or
+     *        wrapped integer. Losing set bits, changing the sign, and negative
+     *        or too large counts are overflows.
+     *
+     * @param rhs Integral operand
+     * @return Reference to self
+     */
+    constexpr Derived &operator<<=(const Operand<RhsT> &rhs)
+    {
+        return Self().template Apply<checks::Operation::Shl>(
+            rhs.value, "Integer overflow in IntWrapper<T>::operator<<=(const value_type&)", rhs.where);
+    }
+
+    /**
+     * @brief Bitwise right shift of the object's value and an integer or
+     *        wrapped integer. Negative or too large counts are overflows.
+     *
+     * @param rhs Integral operand
+     * @return Reference to self
+     */
+    constexpr Derived &operator>>=(const Operand<RhsT> &rhs)
+    {
+        return Self().template Apply<checks::Operation::Shr>(
+            rhs.value, "Integer overflow in IntWrapper<T>::operator>>=(const value_type&)", rhs.where);
+    }
+
+private:
+    constexpr Derived &Self() { return static_cast<Derived &>(*this); }
+};
+
+/**
+ * @brief Checked compound assignments of a wrapper by every right-hand type.
+ *
+ * @tparam Derived Integer wrapper
+ * @tparam RhsTs Right-hand arguments' integral types
+ */
+template <typename Derived, std::integral... RhsTs>
+class CompoundAssignments : public CompoundAssignment<Derived, RhsTs>...
+{
+public:
+    using CompoundAssignment<Derived, RhsTs>::operator+=...;
+    using CompoundAssignment<Derived, RhsTs>::operator-=...;
+    using CompoundAssignment<Derived, RhsTs>::operator*=...;
+    using CompoundAssignment<Derived, RhsTs>::operator/=...;
+    using CompoundAssignment<Derived, RhsTs>::operator<<=...;
+    using CompoundAssignment<Derived, RhsTs>::operator>>=...;
+};
+
+/**
+ * @brief Overloads of Derived by every standard integral type, e.g. the
+ *        compound assignments of CompoundAssignments.
+ */
+template <template <typename, typename...> class Overloads, typename Derived>
+using ForStandardIntegers
+    = Overloads<Derived, bool, char, signed char, unsigned char, wchar_t, char8_t,
+                char16_t, char32_t, short, unsigned short, int, unsigned, long,
+                unsigned long, long long, unsigned long long>;
+
+/**
+ * @brief Checked compound assignments by the standard integral types.
+ */
+template <typename Derived>
+using StandardCompoundAssignments = ForStandardIntegers<CompoundAssignments, Derived>;
+
+} // namespace detail
+
+
+
+
+
 // -------------------------------------------------------------------------- >>
 //                                 IntWrapper                                 >>
 // -------------------------------------------------------------------------- >>
@@ -49,9 +277,10 @@ namespace overflow
  * @brief Wraps around an integral type and provides overflow protection.
  *
  * @tparam T Wrapped integral type
+ * @tparam Policy How operations are checked, see policy.hpp
  */
-template <std::integral T = int>
-class IntWrapper
+template <std::integral T, typename Policy>
+class IntWrapper : public detail::StandardCompoundAssignments<IntWrapper<T, Policy>>
 {
 
 
@@ -64,13 +293,18 @@ public:
     /**
      * @brief Alias to this class.
      */
-    using self_type = IntWrapper<T>;
+    using self_type = IntWrapper<T, Policy>;
 
     /**
      * @brief Stored type.
      */
     using value_type = T;
 
+    /**
+     * @brief Overflow policy.
+     */
+    using policy_type = Policy;
+
 
 
 
@@ -87,14 +321,31 @@ public:
      *
      * @tparam ArgT Argument's type
      * @param val Integral value
+     * @param where Location reported to the policy
      */
     template <std::integral ArgT>
-    constexpr IntWrapper(const ArgT &val)
+    constexpr IntWrapper(const ArgT &val,
+                         std::source_location where = std::source_location::current())
     {
-        if (checks::Assign<value_type, ArgT>(val))
-            throw std::overflow_error("Integer overflow in IntWrapper<T>::IntWrapper<ArgT>(const ArgT&)");
+        Apply<checks::Operation::Assign>(
+            val, "Integer overflow in IntWrapper<T>::IntWrapper<ArgT>(const ArgT&)", where);
+    }
 
-        value = val;
+    /**
+     * @brief Initializes a new instance with the value of a wrapper of another
+     *        type or policy.
+     *
+     * @tparam ArgT Argument's wrapped type
+     * @tparam ArgPolicy Argument's policy
+     * @param val Integer wrapper
+     * @param where Location reported to the policy
+     */
+    template <std::integral ArgT, typename ArgPolicy>
+    constexpr IntWrapper(const IntWrapper<ArgT, ArgPolicy> &val,
+                         std::source_location where = std::source_location::current())
+    {
+        Apply<checks::Operation::Assign>(
+            val.Get(), "Integer overflow in IntWrapper<T>::IntWrapper<ArgT, ArgPolicy>(const IntWrapper<ArgT, ArgPolicy>&)", where);
     }
 
 
@@ -103,175 +354,347 @@ public:
 
 // Assignment operator overloads -------------------------------------------- >>
 
+    // Integers and wrappers are assigned through the converting constructors,
+    // and the checked compound assignments are those of
+    // detail::CompoundAssignment, both reporting the caller's location.
+
+    using detail::StandardCompoundAssignments<self_type>::operator+=;
+    using detail::StandardCompoundAssignments<self_type>::operator-=;
+    using detail::StandardCompoundAssignments<self_type>::operator*=;
+    using detail::StandardCompoundAssignments<self_type>::operator/=;
+    using detail::StandardCompoundAssignments<self_type>::operator<<=;
+    using detail::StandardCompoundAssignments<self_type>::operator>>=;
+
     /**
-     * @brief Assigns an integer to the object.
+     * @brief Multiplies the object's value by a compile-time constant, e.g.
+     *        std::integral_constant<int, 1000>{}. Always checked, by comparing
+     *        against two constants. Reports its own location to the policy,
+     *        use Mul<K>() to report the caller's.
+     *
+     * @tparam RhsT Constant's integral type
+     * @tparam K Multiplier
+     * @return Reference to self
+     */
+    template <std::integral RhsT, RhsT K>
+    constexpr self_type &operator*=(std::integral_constant<RhsT, K>)
+    {
+        return Mul<K>(std::source_location::current());
+    }
+
+    /**
+     * @brief Remainder of the object's value divided by an integer. Always fits
+     *        and isn't checked, but min % -1 is 0 instead of undefined, and the
+     *        remainder keeps the dividend's sign for mixed signedness.
      *
      * @tparam RhsT Right-hand argument's integral type
-     * @param rhs Integral operand
+     * @param rhs Integral operand, not zero
      * @return Reference to self
      */
     template <std::integral RhsT>
-    constexpr self_type &operator=(const RhsT &rhs)
+    constexpr self_type &operator%=(const RhsT &rhs)
     {
-        if (checks::Assign<value_type, RhsT>(rhs))
-            throw std::overflow_error("Integer overflow in IntWrapper<T>::operator=<RhsT>(const RhsT&)");
-
-        value = rhs;
+        using U = wrapping::Unsigned<T, RhsT>;
+        const U remainder = static_cast<U>(static_cast<U>(checks::detail::Magnitude(value))
+                                           % static_cast<U>(checks::detail::Magnitude(rhs)));
+        value = checks::detail::IsNegative(value) ? wrapping::Sub(T{0}, remainder)
+                                                  : static_cast<T>(remainder);
 
         return *this;
     }
 
-    template <std::integral RhsWrappedT>
-    constexpr self_type &operator=(const IntWrapper<RhsWrappedT> &rhs)
+    /**
+     * @brief Bitwise AND of the object's value and an integer.
+     *
+     * @tparam RhsT Right-hand argument's integral type
+     * @param rhs Integral operand
+     * @return Reference to self
+     */
+    template <std::integral RhsT>
+    constexpr self_type &operator&=(const RhsT &rhs)
     {
-        return operator=(rhs.Get());
+        value &= rhs;
+
+        return *this;
     }
 
     /**
-     * @brief Adds an integer to the object's value.
+     * @brief Bitwise XOR of the object's value and an integer.
      *
      * @tparam RhsT Right-hand argument's integral type
      * @param rhs Integral operand
      * @return Reference to self
      */
     template <std::integral RhsT>
-    constexpr self_type &operator+=(const RhsT &rhs)
+    constexpr self_type &operator^=(const RhsT &rhs)
     {
-        if (checks::Sum(value, rhs))
-            throw std::overflow_error("Integer overflow in IntWrapper<T>::operator+=(const value_type&)");
-
-        value += rhs;
+        value ^= rhs;
 
         return *this;
     }
 
     /**
-     * @brief Subtracts an integer from the object's value.
+     * @brief Bitwise OR of the object's value and an integer.
      *
      * @tparam RhsT Right-hand argument's integral type
      * @param rhs Integral operand
      * @return Reference to self
      */
     template <std::integral RhsT>
-    constexpr self_type &operator-=(const RhsT &rhs)
+    constexpr self_type &operator|=(const RhsT &rhs)
     {
-        if (checks::Sub(value, rhs))
-            throw std::overflow_error("Integer overflow in IntWrapper<T>::operator-=(const value_type&)");
+        value |= rhs;
 
-        value -= rhs;
+        return *this;
+    }
+
+    /**
+     * @brief Bitwise left shift of the object's value by a compile-time count,
+     *        e.g. std::integral_constant<int, 3>{}. Always checked, by
+     *        comparing against two constants. Reports its own location to the
+     *        policy.
+     *
+     * @tparam RhsT Count's integral type
+     * @tparam Count Shift count, must be less than the width of T
+     * @return Reference to self
+     */
+    template <std::integral RhsT, RhsT Count>
+    constexpr self_type &operator<<=(std::integral_constant<RhsT, Count>)
+    {
+        const auto where = std::source_location::current();
+
+        policy_type::Bypass(checks::Operation::Shl, where);
+        if (checks::Shl<Count>(value))
+            policy_type::Overflow("Integer overflow in IntWrapper<T>::operator<<=(std::integral_constant<RhsT, Count>)", where);
+
+        value = wrapping::Shl(value, Count);
+        policy_type::Result(checks::Operation::Shl, value, where);
 
         return *this;
     }
 
+
+
+
+
+// Named operations --------------------------------------------------------- >>
+
+    // Checked like the matching compound assignment operators, with a location
+    // that functions reporting their own caller's can pass on.
+
     /**
-     * @brief Multiplies the object's value by an integer.
+     * @brief Adds an integer to the object's value.
      *
      * @tparam RhsT Right-hand argument's integral type
      * @param rhs Integral operand
+     * @param where Location reported to the policy
      * @return Reference to self
      */
     template <std::integral RhsT>
-    constexpr self_type &operator*=(const RhsT &rhs)
+    constexpr self_type &Add(const RhsT &rhs,
+                             std::source_location where = std::source_location::current())
     {
-        if (checks::Mul(value, rhs))
-            throw std::overflow_error("Integer overflow in IntWrapper<T>::operator*=(const value_type&)");
-
-        value *= rhs;
+        return Apply<checks::Operation::Sum>(
+            rhs, "Integer overflow in IntWrapper<T>::Add<RhsT>(const RhsT&)", where);
+    }
 
-        return *this;
+    /**
+     * @brief Subtracts an integer from the object's value.
+     *
+     * @tparam RhsT Right-hand argument's integral type
+     * @param rhs Integral operand
+     * @param where Location reported to the policy
+     * @return Reference to self
+     */
+    template <std::integral RhsT>
+    constexpr self_type &Sub(const RhsT &rhs,
+                             std::source_location where = std::source_location::current())
+    {
+        return Apply<checks::Operation::Sub>(
+            rhs, "Integer overflow in IntWrapper<T>::Sub<RhsT>(const RhsT&)", where);
     }
 
     /**
-     * @brief Divides the object's value by an integer.
+     * @brief Multiplies the object's value by an integer.
      *
      * @tparam RhsT Right-hand argument's integral type
      * @param rhs Integral operand
+     * @param where Location reported to the policy
      * @return Reference to self
      */
     template <std::integral RhsT>
-    constexpr self_type &operator/=(const RhsT &rhs)
+    constexpr self_type &Mul(const RhsT &rhs,
+                             std::source_location where = std::source_location::current())
     {
-        if (checks::Div(value, rhs))
-            throw std::overflow_error("Integer overflow in IntWrapper<T>::operator/=(const value_type&)");
+        return Apply<checks::Operation::Mul>(
+            rhs, "Integer overflow in IntWrapper<T>::Mul<RhsT>(const RhsT&)", where);
+    }
+
+    /**
+     * @brief Multiplies the object's value by a compile-time constant. Always
+     *        checked, by comparing against two constants.
+     *
+     * @tparam K Multiplier, of any integral type
+     * @param where Location reported to the policy
+     * @return Reference to self
+     */
+    template <auto K>
+        requires std::integral<decltype(K)>
+    constexpr self_type &Mul(std::source_location where = std::source_location::current())
+    {
+        policy_type::Bypass(checks::Operation::Mul, where);
+        if (checks::Mul<K>(value))
+            policy_type::Overflow("Integer overflow in IntWrapper<T>::Mul<K>()", where);
 
-        value /= rhs;
+        value = wrapping::Mul(value, K);
+        policy_type::Result(checks::Operation::Mul, value, where);
 
         return *this;
     }
 
     /**
-     * @brief Bitwise AND of the object's value and an integer.
+     * @brief Divides the object's value by an integer.
      *
      * @tparam RhsT Right-hand argument's integral type
      * @param rhs Integral operand
+     * @param where Location reported to the policy
      * @return Reference to self
      */
     template <std::integral RhsT>
-    constexpr self_type &operator&=(const RhsT &rhs)
+    constexpr self_type &Div(const RhsT &rhs,
+                             std::source_location where = std::source_location::current())
     {
-        value &= rhs;
-
-        return *this;
+        return Apply<checks::Operation::Div>(
+            rhs, "Integer overflow in IntWrapper<T>::Div<RhsT>(const RhsT&)", where);
     }
 
     /**
-     * @brief Bitwise XOR of the object's value and an integer.
+     * @brief Assigns an integer to the object.
      *
      * @tparam RhsT Right-hand argument's integral type
      * @param rhs Integral operand
+     * @param where Location reported to the policy
      * @return Reference to self
      */
     template <std::integral RhsT>
-    constexpr self_type &operator^=(const RhsT &rhs)
+    constexpr self_type &Assign(const RhsT &rhs,
+                                std::source_location where = std::source_location::current())
     {
-        value ^= rhs;
+        return Apply<checks::Operation::Assign>(
+            rhs, "Integer overflow in IntWrapper<T>::Assign<RhsT>(const RhsT&)", where);
+    }
 
-        return *this;
+    /**
+     * @brief Adds one to the object's value. Checked with a single comparison.
+     *
+     * @param where Location reported to the policy
+     * @return Reference to self
+     */
+    constexpr self_type &Increment(std::source_location where = std::source_location::current())
+    {
+        return Apply<checks::Operation::Inc>(
+            1, "Integer overflow in IntWrapper<T>::Increment()", where);
     }
 
     /**
-     * @brief Bitwise OR of the object's value and an integer.
+     * @brief Subtracts one from the object's value. Checked with a single
+     *        comparison.
+     *
+     * @param where Location reported to the policy
+     * @return Reference to self
+     */
+    constexpr self_type &Decrement(std::source_location where = std::source_location::current())
+    {
+        return Apply<checks::Operation::Dec>(
+            1, "Integer overflow in IntWrapper<T>::Decrement()", where);
+    }
+
+    /**
+     * @brief Negates the object's value.
+     *
+     * @param where Location reported to the policy
+     * @return Reference to self
+     */
+    constexpr self_type &Negate(std::source_location where = std::source_location::current())
+    {
+        return Apply<checks::Operation::Neg>(
+            0, "Integer overflow in IntWrapper<T>::Negate()", where);
+    }
+
+
+
+
+
+// Non-throwing operations -------------------------------------------------- >>
+
+    // Always checked, bypassing the policy. The value is only modified on
+    // success.
+
+    /**
+     * @brief Adds an integer to the object's value if it doesn't overflow.
      *
      * @tparam RhsT Right-hand argument's integral type
      * @param rhs Integral operand
-     * @return Reference to self
+     * @return Error::None on success
      */
     template <std::integral RhsT>
-    constexpr self_type &operator|=(const RhsT &rhs)
+    [[nodiscard]] constexpr Error TryAdd(const RhsT &rhs) noexcept
     {
-        value |= rhs;
-
-        return *this;
+        return Commit(overflow::TryAdd(value, rhs));
     }
 
     /**
-     * @brief Bitwise left shift of the object's value and an integer.
+     * @brief Subtracts an integer from the object's value if it doesn't
+     *        overflow.
      *
      * @tparam RhsT Right-hand argument's integral type
      * @param rhs Integral operand
-     * @return Reference to self
+     * @return Error::None on success
      */
     template <std::integral RhsT>
-    constexpr self_type &operator<<=(const RhsT &rhs)
+    [[nodiscard]] constexpr Error TrySub(const RhsT &rhs) noexcept
     {
-        value <<= rhs;
+        return Commit(overflow::TrySub(value, rhs));
+    }
 
-        return *this;
+    /**
+     * @brief Multiplies the object's value by an integer if it doesn't
+     *        overflow.
+     *
+     * @tparam RhsT Right-hand argument's integral type
+     * @param rhs Integral operand
+     * @return Error::None on success
+     */
+    template <std::integral RhsT>
+    [[nodiscard]] constexpr Error TryMul(const RhsT &rhs) noexcept
+    {
+        return Commit(overflow::TryMul(value, rhs));
     }
 
     /**
-     * @brief Bitwise right shift of the object's value and an integer.
+     * @brief Divides the object's value by an integer if it doesn't overflow
+     *        and the divisor isn't zero.
      *
      * @tparam RhsT Right-hand argument's integral type
      * @param rhs Integral operand
-     * @return Reference to self
+     * @return Error::None on success
      */
     template <std::integral RhsT>
-    constexpr self_type &operator>>=(const RhsT &rhs)
+    [[nodiscard]] constexpr Error TryDiv(const RhsT &rhs) noexcept
     {
-        value >>= rhs;
+        return Commit(overflow::TryDiv(value, rhs));
+    }
 
-        return *this;
+    /**
+     * @brief Assigns an integer to the object if it fits.
+     *
+     * @tparam RhsT Right-hand argument's integral type
+     * @param rhs Integral operand
+     * @return Error::None on success
+     */
+    template <std::integral RhsT>
+    [[nodiscard]] constexpr Error TryAssign(const RhsT &rhs) noexcept
+    {
+        return Commit(overflow::TryAssign<T>(rhs));
     }
 
 
@@ -281,11 +704,81 @@ public:
 // Unary operators ---------------------------------------------------------- >>
 
     /**
-     * @brief Bitwise NOT of the object's value.
+     * @brief Bitwise NOT of the object's value. Cast back to T, since the
+     *        complement of a promoted value doesn't fit in small unsigned
+     *        types.
      *
-     * @return Reference to self
+     * @return Complemented copy of self
      */
-    constexpr self_type operator~() const { return ~value; }
+    constexpr self_type operator~() const { return static_cast<T>(~value); }
+
+    /**
+     * @brief Copies the object.
+     *
+     * @return Copy of self
+     */
+    constexpr self_type operator+() const { return *this; }
+
+    /**
+     * @brief Negates the object's value. Negating the minimum of a signed type
+     *        or anything but zero in an unsigned type overflows.
+     *
+     * Unlike the other operators, reports its own location to the policy: an
+     * operand converted to record the caller's would be as good a match as
+     * the built-in minus of operator T(), and operators can't have default
+     * arguments. Neg() and Negate() report the caller's.
+     *
+     * @return Negated copy of self
+     */
+    constexpr self_type operator-() const { return Neg(*this, std::source_location::current()); }
+
+    /**
+     * @brief Increments the wrapped value (prefix).
+     *
+     * @param operand Integer wrapper and location of the caller
+     * @return Reference to the operand
+     */
+    friend constexpr self_type &operator++(detail::Target<self_type> operand)
+    {
+        return operand.ref.Increment(operand.where);
+    }
+
+    /**
+     * @brief Increments the wrapped value (postfix).
+     *
+     * @param operand Integer wrapper and location of the caller
+     * @return Copy of the operand before incrementing
+     */
+    friend constexpr self_type operator++(detail::Target<self_type> operand, int)
+    {
+        self_type retval{operand.ref};
+        operand.ref.Increment(operand.where);
+        return retval;
+    }
+
+    /**
+     * @brief Decrements the wrapped value (prefix).
+     *
+     * @param operand Integer wrapper and location of the caller
+     * @return Reference to the operand
+     */
+    friend constexpr self_type &operator--(detail::Target<self_type> operand)
+    {
+        return operand.ref.Decrement(operand.where);
+    }
+
+    /**
+     * @brief Decrements the wrapped value (postfix).
+     *
+     * @param operand Integer wrapper and location of the caller
+     * @return Copy of the operand before decrementing
+     */
+    friend constexpr self_type operator--(detail::Target<self_type> operand, int)
+    {
+        self_type retval{operand.ref};
+        operand.ref.Decrement(operand.where);
+        return retval;
+    }
 
     /**
      * @brief Gets read-only address of the stored value.
@@ -340,9 +833,61 @@ public:
 
 
 
-// Private member variables ------------------------------------------------- >>
+// Private member functions ------------------------------------------------- >>
 
 private:
+    template <typename, std::integral>
+    friend class detail::CompoundAssignment;
+
+    template <std::integral, typename>
+    friend struct detail::BinaryOperation;
+
+    /**
+     * @brief Checks an operation through the policy and applies it.
+     *
+     * @tparam O Operation
+     * @tparam RhsT Right-hand argument's integral type
+     * @param rhs Integral operand
+     * @param what Message passed to the policy on overflow
+     * @param where Location passed to the policy
+     * @return Reference to self
+     */
+    template <checks::Operation O, std::integral RhsT>
+    constexpr self_type &Apply(const RhsT &rhs, const char *what,
+                               const std::source_location &where)
+    {
+        if (policy_type::template Check<O>(value, rhs, where))
+            policy_type::Overflow(what, where);
+
+        value = wrapping::Run<O>(value, rhs);
+        policy_type::Result(O, value, where);
+
+        return *this;
+    }
+
+
+
+
+
+    /**
+     * @brief Stores the result of a Try* function if it succeeded.
+     *
+     * @param result Result
+     * @return The result's error
+     */
+    constexpr Error Commit(const Checked<T> &result) noexcept
+    {
+        if (result.Ok())
+            value = result.value;
+
+        return result.error;
+    }
+
+
+
+
+
+// Private member variables ------------------------------------------------- >>
 
     T value{};
 };
@@ -356,62 +901,100 @@ private:
 
 
 
-// Other operators ---------------------------------------------------------- >>
+// Raw values --------------------------------------------------------------- >>
+
+namespace detail
+{
 
 /**
- * @brief Adds a wrapped integer to the the object's value.
- *
- * @tparam RhsWrappedT Wrapped integer type
- * @param rhs Integer wrapper
- * @return Reference to self
+ * @brief Integral type and policy of an integer or an IntWrapper, integers
+ *        being checked by the default policy.
  */
-template <std::integral LhsWrappedT, std::integral RhsWrappedT>
-constexpr auto &operator+=(IntWrapper<LhsWrappedT> &lhs,
-                    const IntWrapper<RhsWrappedT> &rhs)
+template <typename T>
+struct Raw
 {
-    return lhs += rhs.Get();
-}
+    using type = T;
+    using policy_type = policy::Default;
+};
+
+template <std::integral T, typename Policy>
+struct Raw<IntWrapper<T, Policy>>
+{
+    using type = T;
+    using policy_type = Policy;
+};
 
 /**
- * @brief Subtracts a wrapped integer from the object's value.
- *
- * @tparam RhsWrappedT Wrapped integer type
- * @param rhs Integer wrapper
- * @return Reference to self
+ * @brief Integral type stored by an integer or an IntWrapper.
  */
-template <std::integral LhsWrappedT, std::integral RhsWrappedT>
-constexpr auto &operator-=(IntWrapper<LhsWrappedT> &lhs,
-                    const IntWrapper<RhsWrappedT> &rhs)
-{
-    return lhs -= rhs.Get();
-}
+template <typename T>
+using RawType = typename Raw<std::remove_cv_t<T>>::type;
 
 /**
- * @brief Multiplies the object's value by a wrapped integer.
+ * @brief An integer or an IntWrapper.
+ */
+template <typename T>
+concept IntegerOrWrapper = std::integral<RawType<T>>;
+
+template <std::integral T>
+constexpr const T &RawRef(const T &val) { return val; }
+
+template <std::integral T>
+constexpr T &RawRef(T &val) { return val; }
+
+template <std::integral T, typename Policy>
+constexpr const T &RawRef(const IntWrapper<T, Policy> &val) { return val.Get(); }
+
+template <std::integral T, typename Policy>
+constexpr T &RawRef(IntWrapper<T, Policy> &val) { return val.Get(); }
+
+/**
+ * @brief Wraps the result of an operation checked without the policy, like
+ *        the compile-time shifts. The policy is only told about the
+ *        operation, through Bypass, and about the overflow or the result.
  *
- * @tparam RhsWrappedT Wrapped integer type
- * @param rhs Integer wrapper
- * @return Reference to self
+ * @tparam Policy Policy of the result
+ * @tparam O Operation reported to the policy
+ * @param result Result and error of the operation
+ * @param what Message passed to the policy on overflow
+ * @param where Location passed to the policy
+ * @return Wrapped result
  */
-template <std::integral LhsWrappedT, std::integral RhsWrappedT>
-constexpr auto &operator*=(IntWrapper<LhsWrappedT> &lhs,
-                    const IntWrapper<RhsWrappedT> &rhs)
+template <typename Policy, checks::Operation O, std::integral T>
+constexpr IntWrapper<T, Policy> Commit(const Checked<T> &result, const char *what,
+                                       const std::source_location &where)
 {
-    return lhs *= rhs.Get();
+    Policy::Bypass(O, where);
+    if (!result.Ok())
+        Policy::Overflow(what, where);
+    Policy::Result(O, result.value, where);
+
+    IntWrapper<T, Policy> wrapped;
+    wrapped.Get() = result.value;
+    return wrapped;
 }
 
+} // namespace detail
+
+
+
+
+
+// Other operators ---------------------------------------------------------- >>
+
 /**
- * @brief Divides the object's value by a wrapped integer.
+ * @brief Remainder of the object's value divided by a wrapped integer.
  *
  * @tparam RhsWrappedT Wrapped integer type
  * @param rhs Integer wrapper
  * @return Reference to self
  */
-template <std::integral LhsWrappedT, std::integral RhsWrappedT>
-constexpr auto &operator/=(IntWrapper<LhsWrappedT> &lhs,
-                    const IntWrapper<RhsWrappedT> &rhs)
+template <std::integral LhsWrappedT, typename LhsPolicy,
+          std::integral RhsWrappedT, typename RhsPolicy>
+constexpr auto &operator%=(IntWrapper<LhsWrappedT, LhsPolicy> &lhs,
+                    const IntWrapper<RhsWrappedT, RhsPolicy> &rhs)
 {
-    return lhs /= rhs.Get();
+    return lhs %= rhs.Get();
 }
 
 /**
@@ -421,9 +1004,10 @@ constexpr auto &operator/=(IntWrapper<LhsWrappedT> &lhs,
  * @param rhs Integral operand
  * @return Reference to self
  */
-template <std::integral LhsWrappedT, std::integral RhsWrappedT>
-constexpr auto &operator&=(IntWrapper<LhsWrappedT> &lhs,
-                    const IntWrapper<RhsWrappedT> &rhs)
+template <std::integral LhsWrappedT, typename LhsPolicy,
+          std::integral RhsWrappedT, typename RhsPolicy>
+constexpr auto &operator&=(IntWrapper<LhsWrappedT, LhsPolicy> &lhs,
+                    const IntWrapper<RhsWrappedT, RhsPolicy> &rhs)
 {
     return lhs &= rhs.Get();
 }
@@ -435,9 +1019,10 @@ constexpr auto &operator&=(IntWrapper<LhsWrappedT> &lhs,
  * @param rhs Integral operand
  * @return Reference to self
  */
-template <std::integral LhsWrappedT, std::integral RhsWrappedT>
-constexpr auto &operator^=(IntWrapper<LhsWrappedT> &lhs,
-                    const IntWrapper<RhsWrappedT> &rhs)
+template <std::integral LhsWrappedT, typename LhsPolicy,
+          std::integral RhsWrappedT, typename RhsPolicy>
+constexpr auto &operator^=(IntWrapper<LhsWrappedT, LhsPolicy> &lhs,
+                    const IntWrapper<RhsWrappedT, RhsPolicy> &rhs)
 {
     return lhs ^= rhs.Get();
 }
@@ -449,91 +1034,330 @@ constexpr auto &operator^=(IntWrapper<LhsWrappedT> &lhs,
  * @param rhs Integral operand
  * @return Reference to self
  */
-template <std::integral LhsWrappedT, std::integral RhsWrappedT>
-constexpr auto &operator|=(IntWrapper<LhsWrappedT> &lhs,
-                    const IntWrapper<RhsWrappedT> &rhs)
+template <std::integral LhsWrappedT, typename LhsPolicy,
+          std::integral RhsWrappedT, typename RhsPolicy>
+constexpr auto &operator|=(IntWrapper<LhsWrappedT, LhsPolicy> &lhs,
+                    const IntWrapper<RhsWrappedT, RhsPolicy> &rhs)
 {
     return lhs |= rhs.Get();
 }
 
+// Arithmetic operators ----------------------------------------------------- >>
+
+// Computed in a wrapper of the common type of the operands, like the built-in
+// operators after the usual arithmetic conversions, with the policy of the
+// wrapper operand, the left-hand one if both are wrappers. They report their
+// own location to the policy, since an operand converted to record the
+// caller's would make them as good a match as the built-in operators on
+// operator T().
+
+namespace detail
+{
+
 /**
- * @brief Bitwise left shift of the object's value and a wrapped integer.
+ * @brief Wrapper arithmetic of the operands' common type.
+ */
+template <typename LhsT, typename RhsT, typename Policy>
+using Arithmetic = BinaryOperation<std::common_type_t<RawType<LhsT>, RawType<RhsT>>, Policy>;
+
+template <std::integral C, typename Policy>
+struct BinaryOperation
+{
+    using Result = IntWrapper<C, Policy>;
+
+    /**
+     * @brief Whether every value of T converts to C unchanged.
+     */
+    template <std::integral T>
+    static constexpr bool exact
+        = !checks::detail::Less(std::numeric_limits<T>::min(), std::numeric_limits<C>::min())
+          && !checks::detail::Less(std::numeric_limits<C>::max(), std::numeric_limits<T>::max());
+
+    /**
+     * @brief Converts an operand to C, checked only if it can change. Only a
+     *        negative operand of an unsigned C can.
+     */
+    template <std::integral T>
+    static constexpr Result Convert(const T &val, const char *what, const std::source_location &where)
+    {
+        Result result;
+        if constexpr (exact<T>)
+            result.value = static_cast<C>(val);
+        else
+            result.template Apply<checks::Operation::Assign>(val, what, where);
+        return result;
+    }
+
+    /**
+     * @brief Applies a checked operation. Sums and products start from the
+     *        operand that converts exactly, so only their result is checked.
+     */
+    template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+    static constexpr Result Run(const LhsT &lhs, const RhsT &rhs, const char *what,
+                                const std::source_location &where)
+    {
+        constexpr bool commutative = O == checks::Operation::Sum || O == checks::Operation::Mul;
+
+        Result result;
+        if constexpr (commutative && !exact<LhsT>)
+        {
+            result = Convert(rhs, what, where);
+            result.template Apply<O>(lhs, what, where);
+        }
+        else
+        {
+            result = Convert(lhs, what, where);
+            result.template Apply<O>(rhs, what, where);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Remainder, which always fits once lhs is converted.
+     */
+    template <std::integral LhsT, std::integral RhsT>
+    static constexpr Result Remainder(const LhsT &lhs, const RhsT &rhs, const char *what,
+                                      const std::source_location &where)
+    {
+        Result result = Convert(lhs, what, where);
+        result %= rhs;
+        return result;
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Adds an integer or wrapped integer to a wrapped integer.
  *
- * @tparam RhsWrappedT Wrapped integer type
- * @param rhs Integral operand
- * @return Reference to self
+ * @tparam RhsT Right-hand operand's type, integral or IntWrapper
+ * @param lhs Integer wrapper
+ * @param rhs Right-hand operand
+ * @return Wrapped sum, of the common type of the operands
  */
-template <std::integral LhsWrappedT, std::integral RhsWrappedT>
-constexpr auto &operator<<=(IntWrapper<LhsWrappedT> &lhs,
-                    const IntWrapper<RhsWrappedT> &rhs)
+template <std::integral LhsWrappedT, typename LhsPolicy, detail::IntegerOrWrapper RhsT>
+constexpr auto operator+(const IntWrapper<LhsWrappedT, LhsPolicy> &lhs, const RhsT &rhs)
 {
-    return lhs <<= rhs.Get();
+    return detail::Arithmetic<LhsWrappedT, RhsT, LhsPolicy>::template Run<checks::Operation::Sum>(
+        lhs.Get(), detail::RawRef(rhs), "Integer overflow in operator+(const IntWrapper<T>&, const RhsT&)",
+        std::source_location::current());
 }
 
 /**
- * @brief Bitwise right shift of the object's value and a wrapped integer.
+ * @brief Adds a wrapped integer to an integer.
  *
- * @tparam RhsWrappedT Wrapped integer type
- * @param rhs Integral operand
- * @return Reference to self
+ * @tparam LhsT Left-hand operand's integral type
+ * @param lhs Integral operand
+ * @param rhs Integer wrapper
+ * @return Wrapped sum, of the common type of the operands
  */
-template <std::integral LhsWrappedT, std::integral RhsWrappedT>
-constexpr auto &operator>>=(IntWrapper<LhsWrappedT> &lhs,
-                    const IntWrapper<RhsWrappedT> &rhs)
+template <std::integral LhsT, std::integral RhsWrappedT, typename RhsPolicy>
+constexpr auto operator+(const LhsT &lhs, const IntWrapper<RhsWrappedT, RhsPolicy> &rhs)
 {
-    return lhs >>= rhs.Get();
+    return detail::Arithmetic<LhsT, RhsWrappedT, RhsPolicy>::template Run<checks::Operation::Sum>(
+        lhs, rhs.Get(), "Integer overflow in operator+(const LhsT&, const IntWrapper<T>&)",
+        std::source_location::current());
 }
 
 /**
- * @brief Increments the wrapped value (prefix).
+ * @brief Subtracts an integer or wrapped integer from a wrapped integer.
  *
- * @tparam T Wrapped type
- * @param operand Integer wrapper
- * @return Reference to the operand
+ * @tparam RhsT Right-hand operand's type, integral or IntWrapper
+ * @param lhs Integer wrapper
+ * @param rhs Right-hand operand
+ * @return Wrapped difference, of the common type of the operands
  */
-template <typename T>
-constexpr IntWrapper<T> &operator++(IntWrapper<T> &operand) { return operand += 1; }
+template <std::integral LhsWrappedT, typename LhsPolicy, detail::IntegerOrWrapper RhsT>
+constexpr auto operator-(const IntWrapper<LhsWrappedT, LhsPolicy> &lhs, const RhsT &rhs)
+{
+    return detail::Arithmetic<LhsWrappedT, RhsT, LhsPolicy>::template Run<checks::Operation::Sub>(
+        lhs.Get(), detail::RawRef(rhs), "Integer overflow in operator-(const IntWrapper<T>&, const RhsT&)",
+        std::source_location::current());
+}
 
 /**
- * @brief Increments the wrapped value (postfix).
+ * @brief Subtracts a wrapped integer from an integer.
  *
- * @tparam T Wrapped type
- * @param operand Integer wrapper
- * @return Copy of the operand before incrementing
+ * @tparam LhsT Left-hand operand's integral type
+ * @param lhs Integral operand
+ * @param rhs Integer wrapper
+ * @return Wrapped difference, of the common type of the operands
  */
-template <typename T>
-constexpr IntWrapper<T> operator++(IntWrapper<T> &operand, int)
+template <std::integral LhsT, std::integral RhsWrappedT, typename RhsPolicy>
+constexpr auto operator-(const LhsT &lhs, const IntWrapper<RhsWrappedT, RhsPolicy> &rhs)
 {
-    IntWrapper<T> retval{operand};
-    ++operand;
-    return retval;
+    return detail::Arithmetic<LhsT, RhsWrappedT, RhsPolicy>::template Run<checks::Operation::Sub>(
+        lhs, rhs.Get(), "Integer overflow in operator-(const LhsT&, const IntWrapper<T>&)",
+        std::source_location::current());
 }
 
 /**
- * @brief Decrements the wrapped value (prefix).
+ * @brief Multiplies a wrapped integer by an integer or wrapped integer.
+ *
+ * @tparam RhsT Right-hand operand's type, integral or IntWrapper
+ * @param lhs Integer wrapper
+ * @param rhs Right-hand operand
+ * @return Wrapped product, of the common type of the operands
+ */
+template <std::integral LhsWrappedT, typename LhsPolicy, detail::IntegerOrWrapper RhsT>
+constexpr auto operator*(const IntWrapper<LhsWrappedT, LhsPolicy> &lhs, const RhsT &rhs)
+{
+    return detail::Arithmetic<LhsWrappedT, RhsT, LhsPolicy>::template Run<checks::Operation::Mul>(
+        lhs.Get(), detail::RawRef(rhs), "Integer overflow in operator*(const IntWrapper<T>&, const RhsT&)",
+        std::source_location::current());
+}
+
+/**
+ * @brief Multiplies an integer by a wrapped integer.
+ *
+ * @tparam LhsT Left-hand operand's integral type
+ * @param lhs Integral operand
+ * @param rhs Integer wrapper
+ * @return Wrapped product, of the common type of the operands
+ */
+template <std::integral LhsT, std::integral RhsWrappedT, typename RhsPolicy>
+constexpr auto operator*(const LhsT &lhs, const IntWrapper<RhsWrappedT, RhsPolicy> &rhs)
+{
+    return detail::Arithmetic<LhsT, RhsWrappedT, RhsPolicy>::template Run<checks::Operation::Mul>(
+        lhs, rhs.Get(), "Integer overflow in operator*(const LhsT&, const IntWrapper<T>&)",
+        std::source_location::current());
+}
+
+/**
+ * @brief Divides a wrapped integer by an integer or wrapped integer.
+ *
+ * @tparam RhsT Right-hand operand's type, integral or IntWrapper
+ * @param lhs Integer wrapper
+ * @param rhs Right-hand operand
+ * @return Wrapped quotient, of the common type of the operands
+ */
+template <std::integral LhsWrappedT, typename LhsPolicy, detail::IntegerOrWrapper RhsT>
+constexpr auto operator/(const IntWrapper<LhsWrappedT, LhsPolicy> &lhs, const RhsT &rhs)
+{
+    return detail::Arithmetic<LhsWrappedT, RhsT, LhsPolicy>::template Run<checks::Operation::Div>(
+        lhs.Get(), detail::RawRef(rhs), "Integer overflow in operator/(const IntWrapper<T>&, const RhsT&)",
+        std::source_location::current());
+}
+
+/**
+ * @brief Divides an integer by a wrapped integer.
+ *
+ * @tparam LhsT Left-hand operand's integral type
+ * @param lhs Integral operand
+ * @param rhs Integer wrapper
+ * @return Wrapped quotient, of the common type of the operands
+ */
+template <std::integral LhsT, std::integral RhsWrappedT, typename RhsPolicy>
+constexpr auto operator/(const LhsT &lhs, const IntWrapper<RhsWrappedT, RhsPolicy> &rhs)
+{
+    return detail::Arithmetic<LhsT, RhsWrappedT, RhsPolicy>::template Run<checks::Operation::Div>(
+        lhs, rhs.Get(), "Integer overflow in operator/(const LhsT&, const IntWrapper<T>&)",
+        std::source_location::current());
+}
+
+/**
+ * @brief Remainder of a wrapped integer divided by an integer or wrapped integer.
+ *
+ * @tparam RhsT Right-hand operand's type, integral or IntWrapper
+ * @param lhs Integer wrapper
+ * @param rhs Right-hand operand
+ * @return Wrapped remainder, of the common type of the operands
+ */
+template <std::integral LhsWrappedT, typename LhsPolicy, detail::IntegerOrWrapper RhsT>
+constexpr auto operator%(const IntWrapper<LhsWrappedT, LhsPolicy> &lhs, const RhsT &rhs)
+{
+    return detail::Arithmetic<LhsWrappedT, RhsT, LhsPolicy>::Remainder(
+        lhs.Get(), detail::RawRef(rhs), "Integer overflow in operator%(const IntWrapper<T>&, const RhsT&)",
+        std::source_location::current());
+}
+
+/**
+ * @brief Remainder of an integer divided by a wrapped integer.
+ *
+ * @tparam LhsT Left-hand operand's integral type
+ * @param lhs Integral operand
+ * @param rhs Integer wrapper
+ * @return Wrapped remainder, of the common type of the operands
+ */
+template <std::integral LhsT, std::integral RhsWrappedT, typename RhsPolicy>
+constexpr auto operator%(const LhsT &lhs, const IntWrapper<RhsWrappedT, RhsPolicy> &rhs)
+{
+    return detail::Arithmetic<LhsT, RhsWrappedT, RhsPolicy>::Remainder(
+        lhs, rhs.Get(), "Integer overflow in operator%(const LhsT&, const IntWrapper<T>&)",
+        std::source_location::current());
+}
+
+/**
+ * @brief Negates a wrapped integer, like its unary minus but reporting the
+ *        caller's location.
  *
  * @tparam T Wrapped type
+ * @tparam Policy Overflow policy
  * @param operand Integer wrapper
- * @return Reference to the operand
+ * @param where Location reported to the policy
+ * @return Negated value
  */
-template <typename T>
-constexpr IntWrapper<T> &operator--(IntWrapper<T> &operand) { return operand -= 1; }
+template <typename T, typename Policy>
+constexpr IntWrapper<T, Policy> Neg(const IntWrapper<T, Policy> &operand,
+                                    std::source_location where = std::source_location::current())
+{
+    IntWrapper<T, Policy> retval{operand};
+    retval.Negate(where);
+    return retval;
+}
 
 /**
- * @brief Decrements the wrapped value (postfix).
+ * @brief Computes the absolute value of a wrapped integer. The minimum of a
+ *        signed type overflows.
  *
  * @tparam T Wrapped type
+ * @tparam Policy Overflow policy
  * @param operand Integer wrapper
- * @return Copy of the operand before decrementing
+ * @param where Location reported to the policy
+ * @return Absolute value
  */
-template <typename T>
-constexpr IntWrapper<T> operator--(IntWrapper<T> &operand, int)
+template <typename T, typename Policy>
+constexpr IntWrapper<T, Policy> Abs(const IntWrapper<T, Policy> &operand,
+                                    std::source_location where = std::source_location::current())
 {
-    IntWrapper<T> retval{operand};
-    --operand;
+    IntWrapper<T, Policy> retval{operand};
+    if (retval.Get() < 0)
+        retval.Negate(where);
     return retval;
 }
 
 } // namespace overflow
 
+
+
+
+
+// Common types ------------------------------------------------------------- >>
+
+// Wrappers and integers have no common type by default, since each converts
+// to the other. Mixing them gives a wrapper of the common integral type, with
+// the wrapper's policy.
+
+template <std::integral T, std::integral U, typename Policy>
+struct std::common_type<overflow::IntWrapper<T, Policy>, overflow::IntWrapper<U, Policy>>
+{
+    using type = overflow::IntWrapper<std::common_type_t<T, U>, Policy>;
+};
+
+template <std::integral T, std::integral U, typename Policy>
+struct std::common_type<overflow::IntWrapper<T, Policy>, U>
+{
+    using type = overflow::IntWrapper<std::common_type_t<T, U>, Policy>;
+};
+
+template <std::integral T, std::integral U, typename Policy>
+struct std::common_type<U, overflow::IntWrapper<T, Policy>>
+{
+    using type = overflow::IntWrapper<std::common_type_t<T, U>, Policy>;
+};
+
+#ifdef OVERFLOWWRAPPER_EXTERN_TEMPLATES
+#include "intwrapper_extern.hpp"
+#endif
+
 #endif // #ifndef OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_HPP
\ No newline at end of file
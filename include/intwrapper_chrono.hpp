@@ -0,0 +1,164 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file intwrapper_chrono.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides support for IntWrapper as the representation of
+ *          std::chrono::duration, and checked duration casts.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_CHRONO_HPP
+#define OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_CHRONO_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <source_location>
+#include <type_traits>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                               Duration traits                              >>
+// -------------------------------------------------------------------------- >>
+
+// With these and the arithmetic operators of IntWrapper, the std::chrono
+// duration arithmetic and std::chrono::duration_cast are checked.
+
+template <std::integral T, typename Policy>
+struct std::chrono::treat_as_floating_point<overflow::IntWrapper<T, Policy>>
+    : std::false_type
+{
+};
+
+/**
+ * @brief Limits of durations, which would otherwise be zero since
+ *        std::numeric_limits doesn't know IntWrapper.
+ */
+template <std::integral T, typename Policy>
+struct std::chrono::duration_values<overflow::IntWrapper<T, Policy>>
+{
+    static constexpr overflow::IntWrapper<T, Policy> zero() noexcept { return T{0}; }
+
+    static constexpr overflow::IntWrapper<T, Policy> min() noexcept
+    {
+        return std::numeric_limits<T>::lowest();
+    }
+
+    static constexpr overflow::IntWrapper<T, Policy> max() noexcept
+    {
+        return std::numeric_limits<T>::max();
+    }
+};
+
+
+
+
+
+namespace overflow
+{
+
+// -------------------------------------------------------------------------- >>
+//                                DurationCast                                >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Converts a duration to another period and representation like
+ *        std::chrono::duration_cast, checking the scaling against thresholds
+ *        precomputed for the ratio.
+ *
+ * The count is scaled in the common type of both representations and
+ * std::intmax_t, multiplied by the numerator of the conversion ratio and then
+ * divided by its denominator, like std::chrono::duration_cast does, or by
+ * magnitude if that type is unsigned and the count negative. The
+ * multiplication is checked against the range checks::MulRange computes at
+ * compile time, so each conversion costs two comparisons and the final
+ * conversion's check. The policy is told about a single assignment, through
+ * Bypass.
+ *
+ * @tparam ToDuration Destination duration, with an integral or IntWrapper
+ *         representation
+ * @tparam Rep Source representation, integral or IntWrapper
+ * @tparam Period Source period
+ * @param d Duration
+ * @param where Location reported to the policy, the one of ToDuration's
+ *        representation or policy::Default
+ * @return d in ToDuration
+ */
+template <typename ToDuration, detail::IntegerOrWrapper Rep, typename Period>
+    requires detail::IntegerOrWrapper<typename ToDuration::rep>
+constexpr ToDuration DurationCast(const std::chrono::duration<Rep, Period> &d,
+                                  std::source_location where = std::source_location::current())
+{
+    using ToRep = typename ToDuration::rep;
+    using FromT = detail::RawType<Rep>;
+    using ToT = detail::RawType<ToRep>;
+    using CommonT = std::common_type_t<FromT, ToT, std::intmax_t>;
+    using Ratio = std::ratio_divide<Period, typename ToDuration::period>;
+    using Policy = typename detail::Raw<ToRep>::policy_type;
+
+    constexpr checks::Range<CommonT> range = checks::MulRange<CommonT>(Ratio::num);
+
+    constexpr const char *what = "Integer overflow in DurationCast<ToDuration>(const std::chrono::duration<Rep, Period>&)";
+
+    const Rep count = d.count();
+    const FromT raw = detail::RawRef(count);
+
+    // CommonT is unsigned when ToT is, so negative counts are scaled by
+    // magnitude and only fit if they truncate to zero
+    bool negative = false;
+    CommonT val = raw;
+    if constexpr (std::is_unsigned_v<CommonT> && std::is_signed_v<FromT>)
+    {
+        negative = raw < 0;
+        val = checks::detail::Magnitude(raw);
+    }
+
+    Policy::Bypass(checks::Operation::Assign, where);
+
+    if constexpr (Ratio::num != 1)
+    {
+        if (!range.Contains(val))
+            Policy::Overflow(what, where);
+        val *= Ratio::num;
+    }
+    if constexpr (Ratio::den != 1)
+        val /= Ratio::den;
+
+    if (negative ? val != 0 : checks::Assign<ToT>(val))
+        Policy::Overflow(what, where);
+    Policy::Result(checks::Operation::Assign, static_cast<ToT>(val), where);
+
+    ToRep result{};
+    detail::RawRef(result) = static_cast<ToT>(val);
+    return ToDuration(result);
+}
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_CHRONO_HPP
@@ -0,0 +1,101 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file intwrapper_extern.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Declares explicit instantiations of IntWrapper for every pair of the
+ *          fixed-width integral types.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Included at the end of intwrapper.hpp when OVERFLOWWRAPPER_EXTERN_TEMPLATES
+ * is defined. The member templates of IntWrapper<T> for each right-hand
+ * operand type are then only instantiated in src/intwrapper_instantiations.cpp,
+ * which must be linked in, and not in every translation unit that uses them.
+ * Optimized builds still instantiate them where they are inlined, so the gain
+ * is mostly in unoptimized builds.
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_EXTERN_HPP
+#define OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_EXTERN_HPP
+
+#include <cstdint>
+#include <source_location>
+
+#include "intwrapper.hpp"
+
+// Defined as template by src/intwrapper_instantiations.cpp, which turns the
+// declarations into the definitions
+#ifndef OVERFLOWWRAPPER_EXTERN_TEMPLATE
+#define OVERFLOWWRAPPER_EXTERN_TEMPLATE extern template
+#endif
+
+
+
+
+
+namespace overflow
+{
+
+#define OVERFLOWWRAPPER_EXTERN_PAIR(T, RhsT)                                                            \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T>::IntWrapper(const RhsT &, std::source_location);     \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE class detail::CompoundAssignment<IntWrapper<T>, RhsT>;             \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T> &IntWrapper<T>::operator%=(const RhsT &);             \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T> &IntWrapper<T>::operator&=(const RhsT &);             \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T> &IntWrapper<T>::operator|=(const RhsT &);             \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T> &IntWrapper<T>::operator^=(const RhsT &);             \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T> &IntWrapper<T>::Assign(const RhsT &, std::source_location); \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T> &IntWrapper<T>::Add(const RhsT &, std::source_location); \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T> &IntWrapper<T>::Sub(const RhsT &, std::source_location); \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T> &IntWrapper<T>::Mul(const RhsT &, std::source_location); \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE IntWrapper<T> &IntWrapper<T>::Div(const RhsT &, std::source_location); \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE Error IntWrapper<T>::TryAssign(const RhsT &) noexcept;                \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE Error IntWrapper<T>::TryAdd(const RhsT &) noexcept;                   \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE Error IntWrapper<T>::TrySub(const RhsT &) noexcept;                   \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE Error IntWrapper<T>::TryMul(const RhsT &) noexcept;                   \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE Error IntWrapper<T>::TryDiv(const RhsT &) noexcept;
+
+#define OVERFLOWWRAPPER_EXTERN_ROW(T)                                                                   \
+    OVERFLOWWRAPPER_EXTERN_TEMPLATE class IntWrapper<T>;                                               \
+    OVERFLOWWRAPPER_EXTERN_PAIR(T, std::int8_t)                                                        \
+    OVERFLOWWRAPPER_EXTERN_PAIR(T, std::int16_t)                                                       \
+    OVERFLOWWRAPPER_EXTERN_PAIR(T, std::int32_t)                                                       \
+    OVERFLOWWRAPPER_EXTERN_PAIR(T, std::int64_t)                                                       \
+    OVERFLOWWRAPPER_EXTERN_PAIR(T, std::uint8_t)                                                       \
+    OVERFLOWWRAPPER_EXTERN_PAIR(T, std::uint16_t)                                                      \
+    OVERFLOWWRAPPER_EXTERN_PAIR(T, std::uint32_t)                                                      \
+    OVERFLOWWRAPPER_EXTERN_PAIR(T, std::uint64_t)
+
+OVERFLOWWRAPPER_EXTERN_ROW(std::int8_t)
+OVERFLOWWRAPPER_EXTERN_ROW(std::int16_t)
+OVERFLOWWRAPPER_EXTERN_ROW(std::int32_t)
+OVERFLOWWRAPPER_EXTERN_ROW(std::int64_t)
+OVERFLOWWRAPPER_EXTERN_ROW(std::uint8_t)
+OVERFLOWWRAPPER_EXTERN_ROW(std::uint16_t)
+OVERFLOWWRAPPER_EXTERN_ROW(std::uint32_t)
+OVERFLOWWRAPPER_EXTERN_ROW(std::uint64_t)
+
+#undef OVERFLOWWRAPPER_EXTERN_ROW
+#undef OVERFLOWWRAPPER_EXTERN_PAIR
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_EXTERN_HPP
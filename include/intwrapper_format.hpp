@@ -0,0 +1,199 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file intwrapper_format.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides to_chars, operator<< and std::formatter support for
+ *          IntWrapper.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_FORMAT_HPP
+#define OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_FORMAT_HPP
+
+#include <charconv>
+#include <ostream>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <version>
+
+#ifdef __cpp_lib_format
+#include <format>
+#endif
+
+#include "intwrapper.hpp"
+#include "../src/digits.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+// -------------------------------------------------------------------------- >>
+//                                  to_chars                                  >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Writes the decimal representation of a wrapped integer.
+ *
+ * Formats straight from the stored value two digits at a time, without going
+ * through the conversion operator or any locale.
+ *
+ * @tparam T Wrapped integral type
+ * @tparam Policy Overflow policy
+ * @param first Beginning of the output buffer
+ * @param last End of the output buffer
+ * @param w Integer wrapper
+ * @return Same as std::to_chars
+ */
+template <std::integral T, typename Policy>
+constexpr std::to_chars_result to_chars(char *first, char *last,
+                                        const IntWrapper<T, Policy> &w)
+{
+    const T &val = w.Get();
+    const bool negative = checks::detail::IsNegative(val);
+    // Well-defined even for the minimum value, and bool is 0 or 1
+    const auto magnitude = checks::detail::Magnitude(val);
+
+    const int len = digits::Count(magnitude) + negative;
+    if (last - first < len)
+        return {last, std::errc::value_too_large};
+
+    if (negative)
+        *first = '-';
+    digits::Write(first + len, magnitude);
+
+    return {first + len, std::errc{}};
+}
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                                  Streams                                   >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Inserts a wrapped integer into a stream.
+ *
+ * Decimal output skips the num_put facet and honors width, fill and left
+ * or right adjustment. Other bases, showpos and the internal adjustment of
+ * negative values fall back to the inserter of the promoted wrapped type, so
+ * characters and bool are written as numbers either way.
+ *
+ * @tparam T Wrapped integral type
+ * @tparam Policy Overflow policy
+ * @param os Output stream
+ * @param w Integer wrapper
+ * @return os
+ */
+template <typename CharT, typename Traits, std::integral T, typename Policy>
+std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os,
+                                              const IntWrapper<T, Policy> &w)
+{
+    constexpr auto slow_flags = std::ios_base::showpos
+                                | std::ios_base::oct | std::ios_base::hex;
+
+    // The sign goes before the padding
+    const bool internal = (os.flags() & std::ios_base::adjustfield) == std::ios_base::internal
+                          && checks::detail::IsNegative(w.Get());
+
+    if ((os.flags() & slow_flags) || internal)
+        return os << +w.Get();
+
+    char buf[digits::max_chars<T>];
+    const char *end = to_chars(buf, buf + sizeof buf, w).ptr;
+
+    if constexpr (std::is_same_v<CharT, char>)
+        return os << std::string_view(buf, end);
+    else
+    {
+        CharT wide[digits::max_chars<T>];
+        CharT *out = wide;
+        for (const char *p = buf; p != end; ++p)
+            *out++ = os.widen(*p);
+        return os << std::basic_string_view<CharT, Traits>(wide, out);
+    }
+}
+
+} // namespace overflow
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                                std::format                                 >>
+// -------------------------------------------------------------------------- >>
+
+#ifdef __cpp_lib_format
+
+/**
+ * @brief Formats wrapped integers with the same specifications as the wrapped
+ *        type, taking the to_chars fast path for the empty specification.
+ *        Characters and bool, which the empty specification doesn't format as
+ *        numbers, always go through the formatter of the wrapped type, so that
+ *        e.g. "{}" and "{:>3}" agree.
+ *
+ * @tparam T Wrapped integral type
+ * @tparam Policy Overflow policy
+ * @tparam CharT Character type
+ */
+template <std::integral T, typename Policy, typename CharT>
+struct std::formatter<overflow::IntWrapper<T, Policy>, CharT> : std::formatter<T, CharT>
+{
+    constexpr auto parse(std::basic_format_parse_context<CharT> &ctx)
+    {
+        plain = ctx.begin() == ctx.end() || *ctx.begin() == CharT('}');
+        return std::formatter<T, CharT>::parse(ctx);
+    }
+
+    template <typename FormatContext>
+    auto format(const overflow::IntWrapper<T, Policy> &w, FormatContext &ctx) const
+    {
+        constexpr bool number = !std::is_same_v<T, bool> && !std::is_same_v<T, char>
+                                && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t>
+                                && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+        if (!number || !plain)
+            return std::formatter<T, CharT>::format(w.Get(), ctx);
+
+        char buf[overflow::digits::max_chars<T>];
+        const char *end = overflow::to_chars(buf, buf + sizeof buf, w).ptr;
+
+        auto out = ctx.out();
+        for (const char *p = buf; p != end; ++p)
+            *out++ = static_cast<CharT>(*p);
+        return out;
+    }
+
+private:
+    bool plain = true;
+};
+
+#endif // #ifdef __cpp_lib_format
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_INTWRAPPER_FORMAT_HPP
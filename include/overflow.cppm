@@ -0,0 +1,97 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file overflow.cppm
+ * @author Luiz Fernando F. G. Valle
+ * @brief Module interface unit exporting IntWrapper and the checked numeric
+ *          headers, for use with import overflow;
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Importing the module instead of including the headers saves parsing them,
+ * and the standard headers they use, in every translation unit; most of the
+ * cost of including intwrapper.hpp is <stdexcept>. With GCC:
+ *
+ *   g++ -std=c++20 -fmodules-ts -c -x c++ include/overflow.cppm
+ *
+ * The headers are included in an export block rather than re-exported with
+ * using-declarations, which GCC 12 doesn't export for entities of the global
+ * module fragment. The standard headers they use are included in the global
+ * module fragment, so that they aren't attached to the module.
+ *
+ * With GCC 12, translation units that import the module should include
+ * <source_location> before the import, so that the default arguments of
+ * std::source_location are resolved against the same declaration, and
+ * <thread> if they call CheckedHistogram.
+ *
+ * column_aggregator.hpp, which uses POSIX headers, and telemetry.hpp,
+ * headroom.hpp and sampling.hpp, whose policies keep process-wide registries,
+ * aren't part of the module and are still included as headers.
+ */
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <ratio>
+#include <source_location>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <version>
+#ifdef __cpp_lib_format
+#include <format>
+#endif
+#ifdef __aarch64__
+#include <arm_neon.h>
+#endif
+
+export module overflow;
+
+export
+{
+#include "intwrapper.hpp"
+#include "checked_column.hpp"
+#include "checked_histogram.hpp"
+#include "checked_math.hpp"
+#include "checked_matmul.hpp"
+#include "checked_narrow.hpp"
+#include "checked_size.hpp"
+#include "compile_time.hpp"
+#include "decimal.hpp"
+#include "intwrapper_chrono.hpp"
+#include "intwrapper_format.hpp"
+#include "rational.hpp"
+}
@@ -0,0 +1,506 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file rational.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides a checked rational number that reduces its fractions only
+ *          when an operation would overflow.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_RATIONAL_HPP
+#define OVERFLOWWRAPPER_INCLUDE_RATIONAL_HPP
+
+#include <compare>
+#include <concepts>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <source_location>
+#include <type_traits>
+#include <utility>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+namespace detail
+{
+
+/**
+ * @brief Compares p / q with r / s, for positive q and s, by comparing their
+ *        continued fractions, so no product can overflow.
+ */
+template <std::unsigned_integral U>
+constexpr std::strong_ordering CompareFractions(U p, U q, U r, U s)
+{
+    while (true)
+    {
+        const U whole_lhs = static_cast<U>(p / q);
+        const U whole_rhs = static_cast<U>(r / s);
+        if (whole_lhs != whole_rhs)
+            return whole_lhs <=> whole_rhs;
+
+        p = static_cast<U>(p % q);
+        r = static_cast<U>(r % s);
+        if (p == 0 || r == 0)
+            return (p != 0) <=> (r != 0);
+
+        // p / q < r / s if and only if s / r < q / p
+        std::swap(p, s);
+        std::swap(q, r);
+    }
+}
+
+/**
+ * @brief Checked compound assignments of a Rational by one integral type,
+ *        converted to a Rational.
+ *
+ * @tparam RationalT Rational type
+ * @tparam RhsT Right-hand argument's integral type
+ */
+template <typename RationalT, std::integral RhsT>
+class RationalAssignment
+{
+public:
+    constexpr RationalT &operator+=(const Operand<RhsT> &rhs)
+    {
+        return Self().Add(RationalT(rhs.value, rhs.where), rhs.where);
+    }
+
+    constexpr RationalT &operator-=(const Operand<RhsT> &rhs)
+    {
+        return Self().Sub(RationalT(rhs.value, rhs.where), rhs.where);
+    }
+
+    constexpr RationalT &operator*=(const Operand<RhsT> &rhs)
+    {
+        return Self().Mul(RationalT(rhs.value, rhs.where), rhs.where);
+    }
+
+    constexpr RationalT &operator/=(const Operand<RhsT> &rhs)
+    {
+        return Self().Div(RationalT(rhs.value, rhs.where), rhs.where);
+    }
+
+private:
+    constexpr RationalT &Self() { return static_cast<RationalT &>(*this); }
+};
+
+/**
+ * @brief Combines the compound assignments of a Rational by several integral
+ *        types.
+ */
+template <typename RationalT, std::integral... RhsTs>
+class RationalAssignments : public RationalAssignment<RationalT, RhsTs>...
+{
+public:
+    using RationalAssignment<RationalT, RhsTs>::operator+=...;
+    using RationalAssignment<RationalT, RhsTs>::operator-=...;
+    using RationalAssignment<RationalT, RhsTs>::operator*=...;
+    using RationalAssignment<RationalT, RhsTs>::operator/=...;
+};
+
+} // namespace detail
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                                  Rational                                  >>
+// -------------------------------------------------------------------------- >>
+
+template <typename Int>
+class Rational;
+
+/**
+ * @brief Rational number whose numerator and denominator are checked
+ *        integers, e.g. for periods whose lcm std::lcm computes with
+ *        undefined behavior on overflow.
+ *
+ * Fractions aren't reduced after each operation. Each operation first
+ * computes the unreduced result, (a * d + c * b) / (b * d) for a sum, with
+ * the non-throwing functions. Only if one of those overflows are both
+ * operands reduced and the reduced result computed by cancelling common
+ * factors first, and only if that doesn't fit either is the overflow
+ * reported to the policy. The denominator is always positive.
+ *
+ * Like those of IntWrapper, the operators report the location of their caller
+ * to the policy.
+ *
+ * @tparam T Integral type of the numerator and denominator
+ * @tparam Policy Overflow policy
+ */
+template <std::integral T, typename Policy>
+class Rational<IntWrapper<T, Policy>>
+    : public detail::ForStandardIntegers<detail::RationalAssignments, Rational<IntWrapper<T, Policy>>>
+{
+public:
+    using value_type = IntWrapper<T, Policy>;
+    using policy_type = Policy;
+
+    /**
+     * @brief Initializes the number as zero.
+     */
+    constexpr Rational() = default;
+
+    /**
+     * @brief Initializes the number with an integer.
+     *
+     * @tparam ArgT Argument's integral type
+     * @param whole Integral value
+     * @param where Location reported to the policy
+     */
+    template <std::integral ArgT>
+    constexpr Rational(const ArgT &whole,
+                       std::source_location where = std::source_location::current())
+        : num(whole, where)
+    {
+    }
+
+    /**
+     * @brief Initializes the number with a fraction, which isn't reduced.
+     *
+     * @param numerator Numerator
+     * @param denominator Denominator, zero is reported to the policy as an
+     *        overflow
+     * @param where Location reported to the policy
+     */
+    constexpr Rational(const value_type &numerator, const value_type &denominator,
+                       std::source_location where = std::source_location::current())
+    {
+        const T n = numerator.Get();
+        const T d = denominator.Get();
+
+        if (d == 0)
+            Fail(checks::Operation::Div, "Division by zero in Rational<IntWrapper<T>>::Rational(const IntWrapper<T>&, const IntWrapper<T>&)", where);
+
+        Store(checks::detail::IsNegative(n) != checks::detail::IsNegative(d),
+              checks::detail::Magnitude(n), checks::detail::Magnitude(d), checks::Operation::Div,
+              "Integer overflow in Rational<IntWrapper<T>>::Rational(const IntWrapper<T>&, const IntWrapper<T>&)",
+              where);
+    }
+
+    [[nodiscard]] constexpr const value_type &Num() const { return num; }
+
+    [[nodiscard]] constexpr const value_type &Den() const { return den; }
+
+    /**
+     * @brief Divides the numerator and denominator by their gcd.
+     *
+     * @return Reference to self
+     */
+    constexpr Rational &Reduce() noexcept
+    {
+        // The gcd divides the positive denominator, so it fits
+        const T gcd = static_cast<T>(std::gcd(checks::detail::Magnitude(num.Get()),
+                                              checks::detail::Magnitude(den.Get())));
+        if (gcd > 1)
+        {
+            num.Get() = static_cast<T>(num.Get() / gcd);
+            den.Get() = static_cast<T>(den.Get() / gcd);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Gets the number as a reduced fraction.
+     */
+    [[nodiscard]] constexpr Rational Reduced() const noexcept
+    {
+        Rational reduced = *this;
+        return reduced.Reduce();
+    }
+
+
+
+    constexpr Rational &Add(const Rational &rhs,
+                            std::source_location where = std::source_location::current())
+    {
+        return AddSub<checks::Operation::Sum>(
+            rhs, "Integer overflow in Rational<IntWrapper<T>>::Add(const Rational&)", where);
+    }
+
+    constexpr Rational &Sub(const Rational &rhs,
+                            std::source_location where = std::source_location::current())
+    {
+        return AddSub<checks::Operation::Sub>(
+            rhs, "Integer overflow in Rational<IntWrapper<T>>::Sub(const Rational&)", where);
+    }
+
+    constexpr Rational &Mul(const Rational &rhs,
+                            std::source_location where = std::source_location::current())
+    {
+        const Checked<T> n = TryMul(num.Get(), rhs.num.Get());
+        const Checked<T> d = TryMul(den.Get(), rhs.den.Get());
+        if (n.Ok() && d.Ok())
+            return Assign(n.value, d.value, checks::Operation::Mul, where);
+
+        return MulReduced(checks::detail::IsNegative(rhs.num.Get()),
+                          checks::detail::Magnitude(rhs.num.Get()), static_cast<U>(rhs.den.Get()),
+                          checks::Operation::Mul,
+                          "Integer overflow in Rational<IntWrapper<T>>::Mul(const Rational&)", where);
+    }
+
+    /**
+     * @brief Divides the number by another.
+     *
+     * @param rhs Divisor, zero is reported to the policy as an overflow
+     * @param where Location reported to the policy
+     * @return Reference to self
+     */
+    constexpr Rational &Div(const Rational &rhs,
+                            std::source_location where = std::source_location::current())
+    {
+        const T c = rhs.num.Get();
+        if (c == 0)
+            Fail(checks::Operation::Div, "Division by zero in Rational<IntWrapper<T>>::Div(const Rational&)", where);
+
+        // Multiplies by d / c, whose sign moves to the numerator
+        if (!checks::detail::IsNegative(c))
+        {
+            const Checked<T> n = TryMul(num.Get(), rhs.den.Get());
+            const Checked<T> d = TryMul(den.Get(), c);
+            if (n.Ok() && d.Ok())
+                return Assign(n.value, d.value, checks::Operation::Div, where);
+        }
+
+        return MulReduced(checks::detail::IsNegative(c), static_cast<U>(rhs.den.Get()),
+                          checks::detail::Magnitude(c), checks::Operation::Div,
+                          "Integer overflow in Rational<IntWrapper<T>>::Div(const Rational&)", where);
+    }
+
+
+
+    using detail::ForStandardIntegers<detail::RationalAssignments, Rational>::operator+=;
+    using detail::ForStandardIntegers<detail::RationalAssignments, Rational>::operator-=;
+    using detail::ForStandardIntegers<detail::RationalAssignments, Rational>::operator*=;
+    using detail::ForStandardIntegers<detail::RationalAssignments, Rational>::operator/=;
+
+    constexpr Rational &operator+=(detail::Target<const Rational> rhs) { return Add(rhs.ref, rhs.where); }
+
+    constexpr Rational &operator-=(detail::Target<const Rational> rhs) { return Sub(rhs.ref, rhs.where); }
+
+    constexpr Rational &operator*=(detail::Target<const Rational> rhs) { return Mul(rhs.ref, rhs.where); }
+
+    constexpr Rational &operator/=(detail::Target<const Rational> rhs) { return Div(rhs.ref, rhs.where); }
+
+    friend constexpr Rational operator-(detail::Target<const Rational> operand)
+    {
+        Rational negated;
+        return negated.Sub(operand.ref, operand.where);
+    }
+
+    constexpr Rational operator+() const { return *this; }
+
+    friend constexpr Rational operator+(Rational lhs, const Rational &rhs) { return lhs += rhs; }
+
+    friend constexpr Rational operator-(Rational lhs, const Rational &rhs) { return lhs -= rhs; }
+
+    friend constexpr Rational operator*(Rational lhs, const Rational &rhs) { return lhs *= rhs; }
+
+    friend constexpr Rational operator/(Rational lhs, const Rational &rhs) { return lhs /= rhs; }
+
+    /**
+     * @brief Compares the values, whether or not the fractions are reduced.
+     */
+    friend constexpr bool operator==(const Rational &lhs, const Rational &rhs)
+    {
+        return (lhs <=> rhs) == 0;
+    }
+
+    friend constexpr std::strong_ordering operator<=>(const Rational &lhs, const Rational &rhs)
+    {
+        const bool negative = checks::detail::IsNegative(lhs.num.Get());
+        if (negative != checks::detail::IsNegative(rhs.num.Get()))
+            return negative ? std::strong_ordering::less : std::strong_ordering::greater;
+
+        const std::strong_ordering magnitude = detail::CompareFractions(
+            checks::detail::Magnitude(lhs.num.Get()), static_cast<U>(lhs.den.Get()),
+            checks::detail::Magnitude(rhs.num.Get()), static_cast<U>(rhs.den.Get()));
+        return negative ? 0 <=> magnitude : magnitude;
+    }
+
+    /**
+     * @brief Writes the number as numerator/denominator, as stored.
+     */
+    friend std::ostream &operator<<(std::ostream &os, const Rational &r)
+    {
+        // Promoted, so that 8-bit types print as numbers
+        return os << +r.num.Get() << '/' << +r.den.Get();
+    }
+
+private:
+    using U = std::make_unsigned_t<T>;
+    using Wide = checks::detail::WideUnsigned<2 * sizeof(T)>;
+
+    static_assert(!std::is_void_v<Wide>, "Rational needs an unsigned type twice as wide as T");
+
+    /**
+     * @brief Largest magnitude of a value of T with the given sign.
+     */
+    static constexpr U Limit(bool negative)
+    {
+        return negative ? checks::detail::Magnitude(std::numeric_limits<T>::min())
+                        : static_cast<U>(std::numeric_limits<T>::max());
+    }
+
+    /**
+     * @brief Adds or subtracts rhs, reducing both operands if the unreduced
+     *        result overflows.
+     */
+    template <checks::Operation O>
+    constexpr Rational &AddSub(const Rational &rhs, const char *what,
+                               const std::source_location &where)
+    {
+        const Checked<T> ad = TryMul(num.Get(), rhs.den.Get());
+        const Checked<T> cb = TryMul(rhs.num.Get(), den.Get());
+        const Checked<T> bd = TryMul(den.Get(), rhs.den.Get());
+        if (ad.Ok() && cb.Ok() && bd.Ok())
+        {
+            const Checked<T> n = O == checks::Operation::Sum ? TryAdd(ad.value, cb.value)
+                                                             : TrySub(ad.value, cb.value);
+            if (n.Ok())
+                return Assign(n.value, bd.value, O, where);
+        }
+
+        // With g = gcd(b, d), a / b + c / d = (a * d/g + c * b/g) / (b/g * d),
+        // and only the gcd of the numerator and g is left to cancel. The
+        // numerator is computed exactly in Wide, so only a reduced result
+        // that doesn't fit is reported.
+        Rational other = rhs;
+        Reduce();
+        other.Reduce();
+
+        const U b = static_cast<U>(den.Get());
+        const U d = static_cast<U>(other.den.Get());
+        const U g = std::gcd(b, d);
+
+        const Wide lhs_magnitude = static_cast<Wide>(checks::detail::Magnitude(num.Get())) * (d / g);
+        const Wide rhs_magnitude = static_cast<Wide>(checks::detail::Magnitude(other.num.Get())) * (b / g);
+        const bool lhs_negative = checks::detail::IsNegative(num.Get());
+        const bool rhs_negative = checks::detail::IsNegative(other.num.Get()) != (O == checks::Operation::Sub);
+
+        Wide n = 0;
+        bool negative = lhs_negative;
+        if (lhs_negative == rhs_negative)
+            n = lhs_magnitude + rhs_magnitude;
+        else if (lhs_magnitude >= rhs_magnitude)
+            n = lhs_magnitude - rhs_magnitude;
+        else
+            n = rhs_magnitude - lhs_magnitude, negative = rhs_negative;
+
+        const U cancel = std::gcd(static_cast<U>(n % g), g);
+        n /= cancel;
+        const Wide den_reduced = static_cast<Wide>(b / g) * (d / cancel);
+
+        if (n > Limit(negative) || den_reduced > Limit(false))
+            Fail(O, what, where);
+
+        const auto narrow = static_cast<U>(n);
+        return Assign(negative ? wrapping::Sub(T{0}, narrow) : static_cast<T>(narrow),
+                      static_cast<T>(den_reduced), O, where);
+    }
+
+    /**
+     * @brief Multiplies the number by a fraction given by its sign and
+     *        magnitudes, after reducing both and cancelling their common
+     *        factors, which gives a reduced product, so an overflow here is
+     *        reported to the policy.
+     */
+    constexpr Rational &MulReduced(bool negative, U n, U d, checks::Operation o, const char *what,
+                                   const std::source_location &where)
+    {
+        Reduce();
+        const U rhs_gcd = std::gcd(n, d);
+        n = static_cast<U>(n / rhs_gcd);
+        d = static_cast<U>(d / rhs_gcd);
+
+        const bool lhs_negative = checks::detail::IsNegative(num.Get());
+        U a = checks::detail::Magnitude(num.Get());
+        U b = static_cast<U>(den.Get());
+
+        const U g1 = std::gcd(a, d);
+        const U g2 = std::gcd(n, b);
+        a = static_cast<U>(a / g1);
+        b = static_cast<U>(b / g2);
+        n = static_cast<U>(n / g2);
+        d = static_cast<U>(d / g1);
+
+        if (checks::Mul(a, n) || checks::Mul(b, d))
+            Fail(o, what, where);
+
+        return Store(lhs_negative != negative, wrapping::Mul(a, n), wrapping::Mul(b, d), o, what, where);
+    }
+
+    /**
+     * @brief Sets the number from the sign and magnitudes of a fraction,
+     *        reducing it if it doesn't fit otherwise.
+     */
+    constexpr Rational &Store(bool negative, U n, U d, checks::Operation o, const char *what,
+                              const std::source_location &where)
+    {
+        if (n > Limit(negative) || d > Limit(false))
+        {
+            const U gcd = std::gcd(n, d);
+            n = static_cast<U>(n / gcd);
+            d = static_cast<U>(d / gcd);
+            if (n > Limit(negative) || d > Limit(false))
+                Fail(o, what, where);
+        }
+
+        return Assign(negative ? wrapping::Sub(T{0}, n) : static_cast<T>(n), static_cast<T>(d), o, where);
+    }
+
+    // Every operation ends in either Assign or Fail, which tell the policy
+    // about it, since it's checked without the policy
+
+    constexpr Rational &Assign(const T &n, const T &d, checks::Operation o,
+                               const std::source_location &where)
+    {
+        num.Get() = n;
+        den.Get() = d;
+        Policy::Bypass(o, where);
+        Policy::Result(o, n, where);
+        return *this;
+    }
+
+    [[noreturn]] static void Fail(checks::Operation o, const char *what,
+                                  const std::source_location &where)
+    {
+        Policy::Bypass(o, where);
+        Policy::Overflow(what, where);
+    }
+
+    value_type num;
+    value_type den = value_type(T{1});
+};
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_RATIONAL_HPP
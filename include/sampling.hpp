@@ -0,0 +1,529 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file sampling.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides an overflow policy that checks 1 in N operations per call
+ *          site and verifies the others on a background thread.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_SAMPLING_HPP
+#define OVERFLOWWRAPPER_INCLUDE_SAMPLING_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow::sampling
+{
+
+// -------------------------------------------------------------------------- >>
+//                                 Public API                                 >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief An operation that wasn't checked on the hot path and overflowed.
+ */
+struct Discrepancy
+{
+    checks::Operation operation;
+    std::source_location where;
+    std::string lhs;
+    std::string rhs;
+};
+
+/**
+ * @brief Counters of all the sampled operations so far.
+ */
+struct Stats
+{
+    /**
+     * @brief Operations checked on the calling thread.
+     */
+    std::uint64_t checked = 0;
+
+    /**
+     * @brief Operations left to the shadow checker.
+     */
+    std::uint64_t skipped = 0;
+
+    /**
+     * @brief Skipped operations lost because the queue was full.
+     */
+    std::uint64_t dropped = 0;
+
+    /**
+     * @brief Skipped operations verified by the shadow checker.
+     */
+    std::uint64_t verified = 0;
+
+    /**
+     * @brief Skipped operations the shadow checker found to overflow.
+     */
+    std::uint64_t overflows = 0;
+};
+
+/**
+ * @brief Receives the discrepancies, on the shadow checker's thread.
+ */
+using Handler = void (*)(const Discrepancy &);
+
+namespace detail
+{
+
+inline const char *OperationName(checks::Operation o)
+{
+    switch (o)
+    {
+    case checks::Operation::Assign: return "=";
+    case checks::Operation::Sum: return "+";
+    case checks::Operation::Sub: return "-";
+    case checks::Operation::Mul: return "*";
+    case checks::Operation::Div: return "/";
+    case checks::Operation::Shl: return "<<";
+    case checks::Operation::Shr: return ">>";
+    case checks::Operation::Inc: return "++";
+    case checks::Operation::Dec: return "--";
+    default: return "-";
+    }
+}
+
+inline void PrintDiscrepancy(const Discrepancy &d)
+{
+    std::fprintf(stderr, "%s:%u:%u: unchecked integer overflow in ",
+                 d.where.file_name(), static_cast<unsigned>(d.where.line()),
+                 static_cast<unsigned>(d.where.column()));
+
+    if (d.operation == checks::Operation::Inc || d.operation == checks::Operation::Dec
+        || d.operation == checks::Operation::Neg)
+    {
+        std::fprintf(stderr, "%s%s\n", OperationName(d.operation), d.lhs.c_str());
+    }
+    else
+    {
+        std::fprintf(stderr, "%s %s %s\n", d.lhs.c_str(), OperationName(d.operation),
+                     d.rhs.c_str());
+    }
+}
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                                Sample queue                                >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief A skipped operation, with its operands stored as raw bits and the
+ *        instantiation that knows their types.
+ */
+struct Sample
+{
+    void (*verify)(const Sample &);
+    std::uint64_t lhs;
+    std::uint64_t rhs;
+    std::source_location where;
+};
+
+/**
+ * @brief Single-producer single-consumer queue of one thread's samples, along
+ *        with the thread's counters.
+ */
+class Ring
+{
+public:
+    static constexpr std::size_t capacity = 4096;
+    static constexpr std::size_t sites = 256;
+
+    /**
+     * @brief Queues a sample, or counts it as dropped if the queue is full.
+     *        Producer only.
+     */
+    void Push(const Sample &sample)
+    {
+        const std::size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == capacity)
+        {
+            Bump(dropped);
+            return;
+        }
+
+        samples[h % capacity] = sample;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Verifies all the queued samples. Consumer only.
+     *
+     * @return Number of samples verified
+     */
+    std::size_t Drain()
+    {
+        const std::size_t t = tail.load(std::memory_order_relaxed);
+        const std::size_t h = head.load(std::memory_order_acquire);
+
+        for (std::size_t i = t; i != h; ++i)
+            samples[i % capacity].verify(samples[i % capacity]);
+
+        tail.store(h, std::memory_order_release);
+        return h - t;
+    }
+
+    /**
+     * @brief Increments a counter only written by the producer.
+     */
+    static void Bump(std::atomic<std::uint64_t> &counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    }
+
+    std::atomic<std::uint64_t> checked{0};
+    std::atomic<std::uint64_t> skipped{0};
+    std::atomic<std::uint64_t> dropped{0};
+
+    /**
+     * @brief Operations left until the next check, per call site hash.
+     *        Producer only.
+     */
+    std::array<std::uint32_t, sites> countdown{};
+
+    /**
+     * @brief Set when the producer thread exits.
+     */
+    std::atomic<bool> orphaned{false};
+
+private:
+    std::array<Sample, capacity> samples;
+    alignas(64) std::atomic<std::size_t> head{0};
+    alignas(64) std::atomic<std::size_t> tail{0};
+};
+
+
+
+
+
+// -------------------------------------------------------------------------- >>
+//                               Shadow checker                               >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Owns the queues of all threads and the thread that drains them.
+ */
+class ShadowChecker
+{
+public:
+    static ShadowChecker &Instance()
+    {
+        static ShadowChecker checker;
+        return checker;
+    }
+
+    std::shared_ptr<Ring> Register()
+    {
+        auto ring = std::make_shared<Ring>();
+        const std::lock_guard lock{rings_mutex};
+        rings.push_back(ring);
+        return ring;
+    }
+
+    /**
+     * @brief Verifies everything queued so far by any thread.
+     *
+     * @return Number of samples verified
+     */
+    std::size_t Drain()
+    {
+        const std::lock_guard drain_lock{drain_mutex};
+
+        std::vector<std::shared_ptr<Ring>> snapshot;
+        {
+            const std::lock_guard lock{rings_mutex};
+            snapshot = rings;
+        }
+
+        std::size_t n = 0;
+        for (const auto &ring : snapshot)
+            n += ring->Drain();
+
+        // Rings of finished threads go away once empty, keeping their counts
+        const std::lock_guard lock{rings_mutex};
+        std::erase_if(rings, [this, &n](const auto &ring)
+        {
+            if (!ring->orphaned.load())
+                return false;
+
+            // Samples pushed since the first pass are verified too
+            const std::size_t drained = ring->Drain();
+            n += drained;
+            if (drained != 0)
+                return false;
+
+            retired.checked += ring->checked.load(std::memory_order_relaxed);
+            retired.skipped += ring->skipped.load(std::memory_order_relaxed);
+            retired.dropped += ring->dropped.load(std::memory_order_relaxed);
+            return true;
+        });
+
+        verified.fetch_add(n, std::memory_order_relaxed);
+        return n;
+    }
+
+    Stats GetStats()
+    {
+        Stats stats;
+        const std::lock_guard lock{rings_mutex};
+        for (const auto &ring : rings)
+        {
+            stats.checked += ring->checked.load(std::memory_order_relaxed);
+            stats.skipped += ring->skipped.load(std::memory_order_relaxed);
+            stats.dropped += ring->dropped.load(std::memory_order_relaxed);
+        }
+        stats.checked += retired.checked;
+        stats.skipped += retired.skipped;
+        stats.dropped += retired.dropped;
+        stats.verified = verified.load(std::memory_order_relaxed);
+        stats.overflows = overflows.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void Report(const Discrepancy &d)
+    {
+        overflows.fetch_add(1, std::memory_order_relaxed);
+        if (const Handler h = handler.load(std::memory_order_relaxed))
+            h(d);
+    }
+
+    std::atomic<Handler> handler{&PrintDiscrepancy};
+
+private:
+    ShadowChecker() = default;
+
+    void Run(std::stop_token stop)
+    {
+        using namespace std::chrono_literals;
+
+        while (!stop.stop_requested())
+            if (Drain() == 0)
+                std::this_thread::sleep_for(1ms);
+        Drain();
+    }
+
+    std::mutex drain_mutex;
+    std::mutex rings_mutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+    Stats retired;
+    std::atomic<std::uint64_t> verified{0};
+    std::atomic<std::uint64_t> overflows{0};
+
+    // Declared last so that it's joined before anything else is destroyed
+    std::jthread worker{[this](std::stop_token stop) { Run(stop); }};
+};
+
+/**
+ * @brief Gets the calling thread's queue, creating it on first use.
+ */
+inline Ring &ThreadRing()
+{
+    thread_local constinit Ring *ring = nullptr;
+
+    if (ring == nullptr) [[unlikely]]
+    {
+        struct Owner
+        {
+            std::shared_ptr<Ring> ring = ShadowChecker::Instance().Register();
+            ~Owner() { ring->orphaned.store(true); }
+        };
+        thread_local Owner owner;
+        ring = owner.ring.get();
+    }
+
+    return *ring;
+}
+
+/**
+ * @brief Counts an operation at a call site down.
+ *
+ * @return true The operation must be checked now
+ * @return false The operation can be left to the shadow checker
+ */
+inline bool Due(Ring &ring, const std::source_location &where, std::uint32_t period)
+{
+    // Fibonacci hashing, whose high bits depend on all of the location
+    const auto file = reinterpret_cast<std::uintptr_t>(where.file_name());
+    const std::uint64_t key = (file ^ (std::uint64_t{where.line()} << 32 | where.column()))
+                              * 0x9E3779B97F4A7C15u;
+    const std::size_t site = (key >> 32) % Ring::sites;
+
+    std::uint32_t &left = ring.countdown[site];
+    if (left == 0)
+    {
+        left = period - 1;
+        return true;
+    }
+    --left;
+    return false;
+}
+
+template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+void Verify(const Sample &sample)
+{
+    const auto lhs = static_cast<LhsT>(sample.lhs);
+    const auto rhs = static_cast<RhsT>(sample.rhs);
+
+    if (checks::Run<O>(lhs, rhs))
+    {
+        ShadowChecker::Instance().Report(
+            {O, sample.where, std::to_string(+lhs), std::to_string(+rhs)});
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Sets the function that receives the discrepancies. The default one
+ *        prints them to stderr, nullptr only counts them.
+ */
+inline void SetHandler(Handler handler)
+{
+    detail::ShadowChecker::Instance().handler.store(handler);
+}
+
+/**
+ * @brief Gets the counters of all the sampled operations so far.
+ */
+inline Stats GetStats()
+{
+    return detail::ShadowChecker::Instance().GetStats();
+}
+
+/**
+ * @brief Verifies every operation skipped so far before returning.
+ */
+inline void Flush()
+{
+    detail::ShadowChecker::Instance().Drain();
+}
+
+} // namespace overflow::sampling
+
+
+
+
+
+namespace overflow::policy
+{
+
+// -------------------------------------------------------------------------- >>
+//                                  Sampled                                   >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Checks one in every Period operations of each call site and hands the
+ *        others to a background shadow checker, which reports the ones that
+ *        overflowed through sampling::SetHandler.
+ *
+ * Unchecked operations wrap around. Call sites are told apart by the location
+ * given to the policy, see policy.hpp: every use of a named operation,
+ * constructor, assignment, compound assignment or increment is its own site,
+ * while the uses of a binary operator share the operator's. Constant
+ * evaluation is always checked.
+ *
+ * @tparam Period Sampling period, 1 checks everything
+ * @tparam Base Policy used for the checked operations
+ */
+template <std::uint32_t Period, typename Base = Default>
+struct Sampled
+{
+    static_assert(Period > 0, "Sampling period must be positive");
+
+    template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+    [[nodiscard]] static constexpr bool Check(const LhsT &lhs, const RhsT &rhs,
+                                              const std::source_location &where)
+    {
+        static_assert(sizeof(LhsT) <= sizeof(std::uint64_t)
+                      && sizeof(RhsT) <= sizeof(std::uint64_t));
+
+        if (std::is_constant_evaluated())
+            return Base::template Check<O>(lhs, rhs, where);
+
+        auto &ring = sampling::detail::ThreadRing();
+        if (sampling::detail::Due(ring, where, Period))
+        {
+            ring.Bump(ring.checked);
+            return Base::template Check<O>(lhs, rhs, where);
+        }
+
+        ring.Bump(ring.skipped);
+        ring.Push({&sampling::detail::Verify<O, LhsT, RhsT>,
+                   static_cast<std::uint64_t>(lhs), static_cast<std::uint64_t>(rhs),
+                   where});
+
+        // Base doesn't check it either
+        Base::Bypass(O, where);
+        return false;
+    }
+
+    /**
+     * @brief Operations checked without the policy are always checked, so
+     *        they aren't sampled.
+     */
+    static constexpr void Bypass(checks::Operation o, const std::source_location &where)
+    {
+        Base::Bypass(o, where);
+    }
+
+    template <std::integral T>
+    static constexpr void Result(checks::Operation o, const T &result,
+                                 const std::source_location &where)
+    {
+        Base::Result(o, result, where);
+    }
+
+    [[noreturn]] static void Overflow(const char *what,
+                                      const std::source_location &where)
+    {
+        Base::Overflow(what, where);
+    }
+};
+
+} // namespace overflow::policy
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_SAMPLING_HPP
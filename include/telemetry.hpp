@@ -0,0 +1,475 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file telemetry.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides an overflow policy that counts checked operations and
+ *          overflows per call site.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_INCLUDE_TELEMETRY_HPP
+#define OVERFLOWWRAPPER_INCLUDE_TELEMETRY_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "intwrapper.hpp"
+
+
+
+
+
+namespace overflow::telemetry
+{
+
+// -------------------------------------------------------------------------- >>
+//                                 Public API                                 >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Counters of one operation at one call site, summed over all threads.
+ */
+struct SiteStats
+{
+    std::string file;
+    std::string function;
+    std::uint32_t line = 0;
+    std::uint32_t column = 0;
+    checks::Operation operation = checks::Operation::Assign;
+
+    /**
+     * @brief Operations checked.
+     */
+    std::uint64_t checks = 0;
+
+    /**
+     * @brief Operations that overflowed.
+     */
+    std::uint64_t overflows = 0;
+
+    /**
+     * @brief Lowest checks::HeadroomBits of a result, -1 if no result was
+     *        recorded.
+     */
+    int min_headroom_bits = -1;
+};
+
+namespace detail
+{
+
+/**
+ * @brief One call site's counters in a thread's table. Only the owning thread
+ *        writes, readers see a consistent entry once file is published.
+ */
+struct Site
+{
+    std::atomic<const char *> file{nullptr};
+    const char *function = nullptr;
+    std::uint32_t line = 0;
+    std::uint32_t column = 0;
+    checks::Operation operation = checks::Operation::Assign;
+
+    std::atomic<std::uint64_t> checks{0};
+    std::atomic<std::uint64_t> overflows{0};
+    std::atomic<std::uint8_t> min_headroom_bits{0xFF};
+
+    static void Bump(std::atomic<std::uint64_t> &counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Open-addressed table of one thread's call sites. Sites that don't find
+ *        a free entry within max_probes of their hash are counted in other.
+ */
+class Table
+{
+public:
+    static constexpr std::size_t capacity = 1024;
+    static constexpr std::size_t max_probes = 16;
+
+    Site &Find(const std::source_location &where, checks::Operation o)
+    {
+        const char *file = where.file_name();
+        std::size_t idx = (reinterpret_cast<std::uintptr_t>(file) >> 3
+                           ^ where.line() * 0x9E3779B1u
+                           ^ where.column() * 0x85EBCA6Bu
+                           ^ static_cast<unsigned>(o)) % capacity;
+
+        for (std::size_t probes = 0; probes < max_probes; ++probes)
+        {
+            Site &site = sites[idx];
+            const char *site_file = site.file.load(std::memory_order_relaxed);
+
+            if (site_file == nullptr)
+            {
+                site.function = where.function_name();
+                site.line = where.line();
+                site.column = where.column();
+                site.operation = o;
+                site.file.store(file, std::memory_order_release);
+                return site;
+            }
+            if (site_file == file && site.line == where.line()
+                && site.column == where.column() && site.operation == o)
+            {
+                return site;
+            }
+
+            idx = (idx + 1) % capacity;
+        }
+
+        return other;
+    }
+
+    std::array<Site, capacity> sites;
+    Site other;
+};
+
+using SiteKey = std::tuple<std::string, std::uint32_t, std::uint32_t, int>;
+
+/**
+ * @brief Counters of each call site, summed over the tables merged so far.
+ */
+using SiteMap = std::map<SiteKey, SiteStats>;
+
+/**
+ * @brief Adds the counters of every site of a table to merged.
+ */
+inline void Merge(SiteMap &merged, const Table &table)
+{
+    const auto add = [&merged](const Site &site, const char *file)
+    {
+        SiteStats &stats = merged[{file, site.line, site.column,
+                                   static_cast<int>(site.operation)}];
+        stats.file = file;
+        stats.function = site.function != nullptr ? site.function : "";
+        stats.line = site.line;
+        stats.column = site.column;
+        stats.operation = site.operation;
+        stats.checks += site.checks.load(std::memory_order_relaxed);
+        stats.overflows += site.overflows.load(std::memory_order_relaxed);
+
+        const int bits = site.min_headroom_bits.load(std::memory_order_relaxed);
+        if (bits != 0xFF && (stats.min_headroom_bits == -1 || bits < stats.min_headroom_bits))
+            stats.min_headroom_bits = bits;
+    };
+
+    for (const Site &site : table.sites)
+        if (const char *file = site.file.load(std::memory_order_acquire))
+            add(site, file);
+    if (table.other.checks.load(std::memory_order_relaxed) != 0)
+        add(table.other, "<other>");
+}
+
+/**
+ * @brief Keeps the tables of the running threads, and the counters of those
+ *        of finished threads merged in one aggregate, so that threads that
+ *        come and go don't each leave a table behind.
+ */
+class Registry
+{
+public:
+    static Registry &Instance()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    std::shared_ptr<Table> Register()
+    {
+        auto table = std::make_shared<Table>();
+        const std::lock_guard lock{mutex};
+        tables.push_back(table);
+        return table;
+    }
+
+    /**
+     * @brief Merges the table of a finishing thread into the retired counters
+     *        and releases it.
+     */
+    void Retire(const std::shared_ptr<Table> &table)
+    {
+        const std::lock_guard lock{mutex};
+        Merge(retired, *table);
+        std::erase(tables, table);
+    }
+
+    /**
+     * @brief Gets the tables of the running threads and the counters of the
+     *        finished ones, each thread's counted once.
+     */
+    std::pair<std::vector<std::shared_ptr<Table>>, SiteMap> Snapshot()
+    {
+        const std::lock_guard lock{mutex};
+        return {tables, retired};
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Table>> tables;
+    SiteMap retired;
+};
+
+struct ThreadState
+{
+    ~ThreadState() { Registry::Instance().Retire(table); }
+
+    std::shared_ptr<Table> table = Registry::Instance().Register();
+
+    /**
+     * @brief Site of the last operation, counted by Check or Bypass, where
+     *        its Result and Overflow account to.
+     */
+    Site *current = nullptr;
+};
+
+inline ThreadState &State()
+{
+    thread_local ThreadState state;
+    return state;
+}
+
+/**
+ * @brief Quotes a string, doubling the inner quotes for CSV and escaping them
+ *        with backslashes for JSON and Prometheus.
+ */
+inline std::string Quote(std::string_view s, bool doubled = false)
+{
+    std::string out = "\"";
+    for (char c : s)
+    {
+        if (c == '"')
+            out += doubled ? "\"\"" : "\\\"";
+        else if (c == '\\' && !doubled)
+            out += "\\\\";
+        else if (c == '\n')
+            out += doubled ? " " : "\\n";
+        else
+            out += c;
+    }
+    return out + '"';
+}
+
+} // namespace detail
+
+/**
+ * @brief Collects the counters of every call site seen by any thread.
+ *
+ * Reading doesn't block the instrumented threads, so counters of operations
+ * running concurrently may or may not be included.
+ *
+ * @return Sites sorted by file, line, column and operation
+ */
+inline std::vector<SiteStats> Collect()
+{
+    auto [tables, merged] = detail::Registry::Instance().Snapshot();
+    for (const auto &table : tables)
+        detail::Merge(merged, *table);
+
+    std::vector<SiteStats> sites;
+    sites.reserve(merged.size());
+    for (auto &[key, stats] : merged)
+        sites.push_back(std::move(stats));
+    return sites;
+}
+
+/**
+ * @brief Writes the counters of every call site as CSV with a header line.
+ */
+inline void WriteCsv(std::ostream &os)
+{
+    os << "file,line,column,function,operation,checks,overflows,min_headroom_bits\n";
+    for (const SiteStats &s : Collect())
+    {
+        os << detail::Quote(s.file, true) << ',' << s.line << ',' << s.column << ','
+           << detail::Quote(s.function, true) << ',' << checks::Name(s.operation) << ','
+           << s.checks << ',' << s.overflows << ',' << s.min_headroom_bits << '\n';
+    }
+}
+
+/**
+ * @brief Writes the counters of every call site as a JSON array of objects.
+ */
+inline void WriteJson(std::ostream &os)
+{
+    os << '[';
+    bool first = true;
+    for (const SiteStats &s : Collect())
+    {
+        os << (first ? "\n" : ",\n") << "  {\"file\": " << detail::Quote(s.file)
+           << ", \"line\": " << s.line << ", \"column\": " << s.column
+           << ", \"function\": " << detail::Quote(s.function)
+           << ", \"operation\": \"" << checks::Name(s.operation)
+           << "\", \"checks\": " << s.checks << ", \"overflows\": " << s.overflows
+           << ", \"min_headroom_bits\": " << s.min_headroom_bits << '}';
+        first = false;
+    }
+    os << "\n]\n";
+}
+
+/**
+ * @brief Writes the counters of every call site in the Prometheus text
+ *        exposition format.
+ */
+inline void WritePrometheus(std::ostream &os)
+{
+    const auto sites = Collect();
+
+    const auto write = [&](const char *name, const char *type, const char *help,
+                           auto value)
+    {
+        os << "# HELP " << name << ' ' << help << "\n# TYPE " << name << ' ' << type << '\n';
+        for (const SiteStats &s : sites)
+        {
+            if (value(s) < 0)
+                continue;
+            os << name << "{file=" << detail::Quote(s.file) << ",line=\"" << s.line
+               << "\",column=\"" << s.column << "\",function=" << detail::Quote(s.function)
+               << ",operation=\"" << checks::Name(s.operation) << "\"} " << value(s) << '\n';
+        }
+    };
+
+    write("overflow_checks_total", "counter", "Checked IntWrapper operations.",
+          [](const SiteStats &s) { return static_cast<std::int64_t>(s.checks); });
+    write("overflow_overflows_total", "counter", "IntWrapper operations that overflowed.",
+          [](const SiteStats &s) { return static_cast<std::int64_t>(s.overflows); });
+    write("overflow_min_headroom_bits", "gauge",
+          "Lowest number of times a result could have doubled without overflowing.",
+          [](const SiteStats &s) { return static_cast<std::int64_t>(s.min_headroom_bits); });
+}
+
+} // namespace overflow::telemetry
+
+
+
+
+
+namespace overflow::policy
+{
+
+// -------------------------------------------------------------------------- >>
+//                                 Telemetry                                  >>
+// -------------------------------------------------------------------------- >>
+
+/**
+ * @brief Counts the checked operations, overflows and lowest headroom of the
+ *        results of every call site in per-thread tables, and adds the call
+ *        site to overflow messages.
+ *
+ * Call sites are the locations given to the policy, see policy.hpp: every
+ * use of a named operation, constructor, assignment, compound assignment or
+ * increment is its own site, while the uses of a binary operator share the
+ * operator's. Constant evaluation isn't counted.
+ *
+ * @tparam Base Policy the checks and overflows are forwarded to
+ */
+template <typename Base = Default>
+struct Telemetry
+{
+    template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+    [[nodiscard]] static constexpr bool Check(const LhsT &lhs, const RhsT &rhs,
+                                              const std::source_location &where)
+    {
+        if (!std::is_constant_evaluated())
+            Count(O, where);
+
+        return Base::template Check<O>(lhs, rhs, where);
+    }
+
+    static constexpr void Bypass(checks::Operation o, const std::source_location &where)
+    {
+        if (!std::is_constant_evaluated())
+            Count(o, where);
+
+        Base::Bypass(o, where);
+    }
+
+    template <std::integral T>
+    static constexpr void Result(checks::Operation o, const T &result,
+                                 const std::source_location &where)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            // Counted by the Check or Bypass of the same operation
+            auto &bits = telemetry::detail::State().current->min_headroom_bits;
+            const auto headroom = static_cast<std::uint8_t>(checks::HeadroomBits(result));
+            if (headroom < bits.load(std::memory_order_relaxed))
+                bits.store(headroom, std::memory_order_relaxed);
+        }
+
+        Base::Result(o, result, where);
+    }
+
+    [[noreturn]] static void Overflow(const char *what,
+                                      const std::source_location &where)
+    {
+        telemetry::detail::Site::Bump(telemetry::detail::State().current->overflows);
+
+        const std::string message = std::string(what) + " at " + where.file_name()
+                                    + ':' + std::to_string(where.line())
+                                    + ':' + std::to_string(where.column())
+                                    + " in " + where.function_name();
+        Base::Overflow(message.c_str(), where);
+    }
+
+private:
+    /**
+     * @brief Counts an operation at its call site, where its Result or
+     *        Overflow accounts to.
+     */
+    static void Count(checks::Operation o, const std::source_location &where)
+    {
+        auto &state = telemetry::detail::State();
+        const telemetry::detail::Site *last = state.current;
+
+        // Repeating the last operation, as loops do, skips the lookup
+        if (last == nullptr || last->file.load(std::memory_order_relaxed) != where.file_name()
+            || last->line != where.line() || last->column != where.column()
+            || last->operation != o)
+        {
+            state.current = &state.table->Find(where, o);
+        }
+        telemetry::detail::Site::Bump(state.current->checks);
+    }
+};
+
+} // namespace overflow::policy
+
+#endif // #ifndef OVERFLOWWRAPPER_INCLUDE_TELEMETRY_HPP
@@ -0,0 +1,306 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file asm_aarch64.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides the AArch64 inline assembly and NEON kernels of the asm
+ *          backend.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Additions and subtractions of 32- and 64-bit operands run adds or subs and
+ * read NZCV through flag output operands (=@ccvs, =@cchs, =@cclo), so the
+ * compiler branches on them with b.vs/b.hs/b.lo or materializes them with
+ * cset. Multiplications compute the high half of the product, with smull or
+ * umull for 32-bit operands and smulh or umulh for 64-bit ones, and compare
+ * it with the sign of the low half, without any division. Not usable in
+ * constant expressions.
+ *
+ * Also provides NEON kernels for the element-wise operations of
+ * CheckedColumn, which compare the wrapping and saturating (sqadd, uqadd...)
+ * results of each vector.
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_SRC_ASM_AARCH64_HPP
+#define OVERFLOWWRAPPER_SRC_ASM_AARCH64_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Before arm_neon.h, which fails less clearly on other targets
+#if !defined(__aarch64__) || !defined(__GCC_ASM_FLAG_OUTPUTS__)
+#error "asm_aarch64.hpp needs AArch64 and a compiler with asm flag outputs"
+#endif
+
+#include <arm_neon.h>
+
+// Span kernels are available, see AsmSpan
+#define OVERFLOWWRAPPER_ASM_SPANS
+
+
+
+
+
+namespace overflow::checks::detail
+{
+
+/**
+ * @brief Operations of the asm backend on AArch64.
+ *
+ * Each stores the wrapped result in lhs and returns whether it overflowed.
+ * Bytes and halfwords have no flag-setting arithmetic, but their operations
+ * are exact in 64 bits, so they are checked by narrowing the exact result.
+ *
+ * @tparam T Integral type of both operands
+ */
+template <std::integral T>
+struct Asm
+{
+    static bool Add(T &lhs, const T &rhs)
+    {
+        if constexpr (sizeof(T) < 4)
+            return Narrow(lhs, std::int64_t{lhs} + rhs);
+        else
+        {
+            bool flag;
+            if constexpr (sizeof(T) == 4 && std::is_signed_v<T>)
+                asm("adds %w[lhs], %w[lhs], %w[rhs]" : [lhs] "+r"(lhs), "=@ccvs"(flag) : [rhs] "r"(rhs));
+            else if constexpr (sizeof(T) == 4)
+                asm("adds %w[lhs], %w[lhs], %w[rhs]" : [lhs] "+r"(lhs), "=@cchs"(flag) : [rhs] "r"(rhs));
+            else if constexpr (std::is_signed_v<T>)
+                asm("adds %x[lhs], %x[lhs], %x[rhs]" : [lhs] "+r"(lhs), "=@ccvs"(flag) : [rhs] "r"(rhs));
+            else
+                asm("adds %x[lhs], %x[lhs], %x[rhs]" : [lhs] "+r"(lhs), "=@cchs"(flag) : [rhs] "r"(rhs));
+            return flag;
+        }
+    }
+
+    /**
+     * @brief Unsigned subtractions borrow when the carry is clear (lo).
+     */
+    static bool Sub(T &lhs, const T &rhs)
+    {
+        if constexpr (sizeof(T) < 4)
+            return Narrow(lhs, std::int64_t{lhs} - rhs);
+        else
+        {
+            bool flag;
+            if constexpr (sizeof(T) == 4 && std::is_signed_v<T>)
+                asm("subs %w[lhs], %w[lhs], %w[rhs]" : [lhs] "+r"(lhs), "=@ccvs"(flag) : [rhs] "r"(rhs));
+            else if constexpr (sizeof(T) == 4)
+                asm("subs %w[lhs], %w[lhs], %w[rhs]" : [lhs] "+r"(lhs), "=@cclo"(flag) : [rhs] "r"(rhs));
+            else if constexpr (std::is_signed_v<T>)
+                asm("subs %x[lhs], %x[lhs], %x[rhs]" : [lhs] "+r"(lhs), "=@ccvs"(flag) : [rhs] "r"(rhs));
+            else
+                asm("subs %x[lhs], %x[lhs], %x[rhs]" : [lhs] "+r"(lhs), "=@cclo"(flag) : [rhs] "r"(rhs));
+            return flag;
+        }
+    }
+
+    /**
+     * @brief The product fits when its high half is the sign extension of
+     *        its low half, for signed types, or zero, for unsigned ones.
+     */
+    static bool Mul(T &lhs, const T &rhs)
+    {
+        if constexpr (sizeof(T) < 4)
+            return Narrow(lhs, std::int64_t{lhs} * rhs);
+        else
+        {
+            bool flag;
+            if constexpr (sizeof(T) == 4)
+            {
+                std::uint64_t product;
+                if constexpr (std::is_signed_v<T>)
+                    asm("smull %x[product], %w[lhs], %w[rhs]\n\t"
+                        "cmp %x[product], %w[product], sxtw"
+                        : [product] "=r"(product), "=@ccne"(flag)
+                        : [lhs] "r"(lhs), [rhs] "r"(rhs));
+                else
+                    asm("umull %x[product], %w[lhs], %w[rhs]\n\t"
+                        "tst %x[product], #0xffffffff00000000"
+                        : [product] "=r"(product), "=@ccne"(flag)
+                        : [lhs] "r"(lhs), [rhs] "r"(rhs));
+                lhs = static_cast<T>(product);
+            }
+            else
+            {
+                // low is written before the high half reads the operands
+                std::uint64_t low;
+                std::uint64_t high;
+                if constexpr (std::is_signed_v<T>)
+                    asm("mul %x[low], %x[lhs], %x[rhs]\n\t"
+                        "smulh %x[high], %x[lhs], %x[rhs]\n\t"
+                        "cmp %x[high], %x[low], asr #63"
+                        : [low] "=&r"(low), [high] "=r"(high), "=@ccne"(flag)
+                        : [lhs] "r"(lhs), [rhs] "r"(rhs));
+                else
+                    asm("mul %x[low], %x[lhs], %x[rhs]\n\t"
+                        "umulh %x[high], %x[lhs], %x[rhs]\n\t"
+                        "cmp %x[high], #0"
+                        : [low] "=&r"(low), [high] "=r"(high), "=@ccne"(flag)
+                        : [lhs] "r"(lhs), [rhs] "r"(rhs));
+                lhs = static_cast<T>(low);
+            }
+            return flag;
+        }
+    }
+
+private:
+    static bool Narrow(T &lhs, std::int64_t exact)
+    {
+        lhs = static_cast<T>(exact);
+        return exact != lhs;
+    }
+};
+
+
+
+
+
+/**
+ * @brief NEON operations on vectors of T, specialized for the fixed-width
+ *        integral types.
+ */
+template <typename T>
+struct Neon
+{
+};
+
+/**
+ * @brief Bits of a vector, for testing whether any is set.
+ */
+inline uint64x2_t Identity(uint64x2_t v)
+{
+    return v;
+}
+
+#define OVERFLOWWRAPPER_NEON(T, VecT, suffix, ToU64)                                           \
+    template <>                                                                                \
+    struct Neon<T>                                                                             \
+    {                                                                                          \
+        using vec_type = VecT;                                                                 \
+        static VecT Load(const T *p) { return vld1q_##suffix(p); }                             \
+        static void Store(T *p, VecT v) { vst1q_##suffix(p, v); }                              \
+        static VecT Add(VecT a, VecT b) { return vaddq_##suffix(a, b); }                       \
+        static VecT Sub(VecT a, VecT b) { return vsubq_##suffix(a, b); }                       \
+        static VecT SatAdd(VecT a, VecT b) { return vqaddq_##suffix(a, b); }                   \
+        static VecT SatSub(VecT a, VecT b) { return vqsubq_##suffix(a, b); }                   \
+        static uint64x2_t Differ(VecT a, VecT b) { return ToU64(veorq_##suffix(a, b)); }       \
+    };
+
+OVERFLOWWRAPPER_NEON(std::int8_t, int8x16_t, s8, vreinterpretq_u64_s8)
+OVERFLOWWRAPPER_NEON(std::int16_t, int16x8_t, s16, vreinterpretq_u64_s16)
+OVERFLOWWRAPPER_NEON(std::int32_t, int32x4_t, s32, vreinterpretq_u64_s32)
+OVERFLOWWRAPPER_NEON(std::int64_t, int64x2_t, s64, vreinterpretq_u64_s64)
+OVERFLOWWRAPPER_NEON(std::uint8_t, uint8x16_t, u8, vreinterpretq_u64_u8)
+OVERFLOWWRAPPER_NEON(std::uint16_t, uint16x8_t, u16, vreinterpretq_u64_u16)
+OVERFLOWWRAPPER_NEON(std::uint32_t, uint32x4_t, u32, vreinterpretq_u64_u32)
+OVERFLOWWRAPPER_NEON(std::uint64_t, uint64x2_t, u64, Identity)
+
+#undef OVERFLOWWRAPPER_NEON
+
+/**
+ * @brief Element-wise operations on spans of T, for CheckedColumn.
+ *
+ * Each vector is computed both wrapping and saturating, and its lanes
+ * overflowed where the two differ: a wrapped result never equals the limit
+ * the saturated one is clamped to. Elements left over after the last vector
+ * use Asm.
+ *
+ * @tparam T Integral type of the elements
+ */
+template <typename T>
+struct AsmSpan
+{
+    static constexpr bool supported = requires { typename Neon<T>::vec_type; };
+
+    /**
+     * @brief Adds rhs to lhs element by element, wrapping around.
+     *
+     * @return Index of the first element that overflowed, n if none did
+     */
+    static std::size_t Add(T *lhs, const T *rhs, std::size_t n)
+    {
+        return Run<true>(lhs, rhs, n);
+    }
+
+    /**
+     * @brief Subtracts rhs from lhs element by element, wrapping around.
+     *
+     * @return Index of the first element that overflowed, n if none did
+     */
+    static std::size_t Sub(T *lhs, const T *rhs, std::size_t n)
+    {
+        return Run<false>(lhs, rhs, n);
+    }
+
+private:
+    template <bool Sum>
+    static std::size_t Run(T *lhs, const T *rhs, std::size_t n)
+    {
+        using Ops = Neon<T>;
+        using Vec = typename Ops::vec_type;
+
+        constexpr std::size_t lanes = sizeof(Vec) / sizeof(T);
+
+        std::size_t first = n;
+        std::size_t i = 0;
+
+        for (; n - i >= lanes; i += lanes)
+        {
+            const Vec l = Ops::Load(lhs + i);
+            const Vec r = Ops::Load(rhs + i);
+            const Vec wrapped = Sum ? Ops::Add(l, r) : Ops::Sub(l, r);
+            const Vec saturated = Sum ? Ops::SatAdd(l, r) : Ops::SatSub(l, r);
+            Ops::Store(lhs + i, wrapped);
+
+            const uint64x2_t differ = Ops::Differ(wrapped, saturated);
+            if ((vgetq_lane_u64(differ, 0) | vgetq_lane_u64(differ, 1)) != 0 && first == n)
+            {
+                T w[lanes];
+                T s[lanes];
+                Ops::Store(w, wrapped);
+                Ops::Store(s, saturated);
+
+                std::size_t j = 0;
+                while (w[j] == s[j])
+                    ++j;
+                first = i + j;
+            }
+        }
+
+        for (; i < n; ++i)
+        {
+            const bool overflow = Sum ? Asm<T>::Add(lhs[i], rhs[i]) : Asm<T>::Sub(lhs[i], rhs[i]);
+            if (overflow && first == n)
+                first = i;
+        }
+
+        return first;
+    }
+};
+
+} // namespace overflow::checks::detail
+
+#endif // #ifndef OVERFLOWWRAPPER_SRC_ASM_AARCH64_HPP
@@ -0,0 +1,114 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file asm_x86_64.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides the x86-64 inline assembly of the asm backend.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Each operation runs one instruction on operands of the same type and reads
+ * its flags through flag output operands (=@cco, =@ccc), so the compiler
+ * branches on them with jo/jc or materializes them with seto/setc, without
+ * an extra comparison. Not usable in constant expressions.
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_SRC_ASM_X86_64_HPP
+#define OVERFLOWWRAPPER_SRC_ASM_X86_64_HPP
+
+#include <concepts>
+#include <type_traits>
+
+#if !defined(__x86_64__) || !defined(__GCC_ASM_FLAG_OUTPUTS__)
+#error "asm_x86_64.hpp needs x86-64 and a compiler with asm flag outputs"
+#endif
+
+
+
+
+
+namespace overflow::checks::detail
+{
+
+/**
+ * @brief Operations of the asm backend on x86-64.
+ *
+ * Each stores the wrapped result in lhs and returns whether it overflowed:
+ * OF for signed types, CF for unsigned ones.
+ *
+ * @tparam T Integral type of both operands
+ */
+template <std::integral T>
+struct Asm
+{
+    static bool Add(T &lhs, const T &rhs)
+    {
+        bool flag;
+        if constexpr (std::is_signed_v<T>)
+            asm("add %[rhs], %[lhs]" : [lhs] "+r"(lhs), "=@cco"(flag) : [rhs] "r"(rhs));
+        else
+            asm("add %[rhs], %[lhs]" : [lhs] "+r"(lhs), "=@ccc"(flag) : [rhs] "r"(rhs));
+        return flag;
+    }
+
+    static bool Sub(T &lhs, const T &rhs)
+    {
+        bool flag;
+        if constexpr (std::is_signed_v<T>)
+            asm("sub %[rhs], %[lhs]" : [lhs] "+r"(lhs), "=@cco"(flag) : [rhs] "r"(rhs));
+        else
+            asm("sub %[rhs], %[lhs]" : [lhs] "+r"(lhs), "=@ccc"(flag) : [rhs] "r"(rhs));
+        return flag;
+    }
+
+    /**
+     * @brief Signed types use the two-operand imul, which sets OF when the
+     *        product doesn't fit, and unsigned ones the one-operand mul,
+     *        which sets CF when the high half in rdx isn't zero. Bytes have
+     *        no two-operand form, so they use the one-operand imul or mul of
+     *        al, whose product is in ax.
+     */
+    static bool Mul(T &lhs, const T &rhs)
+    {
+        bool flag;
+        if constexpr (sizeof(T) == 1)
+        {
+            unsigned short ax = static_cast<unsigned char>(lhs);
+            if constexpr (std::is_signed_v<T>)
+                asm("imulb %[rhs]" : "+a"(ax), "=@cco"(flag) : [rhs] "q"(rhs));
+            else
+                asm("mulb %[rhs]" : "+a"(ax), "=@ccc"(flag) : [rhs] "q"(rhs));
+            lhs = static_cast<T>(ax);
+        }
+        else if constexpr (std::is_signed_v<T>)
+            asm("imul %[rhs], %[lhs]" : [lhs] "+r"(lhs), "=@cco"(flag) : [rhs] "r"(rhs));
+        else
+        {
+            T high;
+            asm("mul %[rhs]" : "+a"(lhs), "=d"(high), "=@ccc"(flag) : [rhs] "r"(rhs));
+        }
+        return flag;
+    }
+};
+
+} // namespace overflow::checks::detail
+
+#endif // #ifndef OVERFLOWWRAPPER_SRC_ASM_X86_64_HPP
@@ -0,0 +1,187 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file checked.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides checked arithmetic that reports overflow in its return value
+ *          instead of throwing.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_SRC_CHECKED_HPP
+#define OVERFLOWWRAPPER_SRC_CHECKED_HPP
+
+#include <concepts>
+#include <type_traits>
+
+#include "overflow_checks.hpp"
+#include "wrapping.hpp"
+
+
+
+
+
+namespace overflow
+{
+
+/* -------------------------------------------------------------------------- */
+/*                                Result types                                */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief Error reported by the Try* functions.
+ */
+enum class Error
+{
+    None,
+    Overflow,
+    DivisionByZero
+};
+
+/**
+ * @brief Value and error of a Try* function, small enough to be returned in
+ *        registers.
+ *
+ * @tparam T Integral type of the result
+ */
+template <std::integral T>
+struct Checked
+{
+    /**
+     * @brief Result. On Error::Overflow, the result wrapped around the range
+     *        of T. On Error::DivisionByZero, the dividend.
+     */
+    T value;
+
+    Error error;
+
+    /**
+     * @brief Checks if the operation succeeded.
+     */
+    [[nodiscard]] constexpr bool Ok() const { return error == Error::None; }
+
+    constexpr explicit operator bool() const { return Ok(); }
+};
+
+
+
+
+
+/* -------------------------------------------------------------------------- */
+/*                              Try* functions                                */
+/* -------------------------------------------------------------------------- */
+
+// Each function computes the result in LhsT's range, like the matching
+// IntWrapper<LhsT> compound assignment, and never throws. With the builtin
+// and asm backends, the result and the overflow come from a single builtin
+// or instruction.
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr Checked<LhsT> TryAdd(const LhsT &lhs, const RhsT &rhs) noexcept
+{
+    if constexpr (checks::detail::use_asm<LhsT, RhsT>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            LhsT result = lhs;
+            const bool overflow = checks::detail::Asm<LhsT>::Add(result, static_cast<LhsT>(rhs));
+            return {result, overflow ? Error::Overflow : Error::None};
+        }
+    }
+
+    if constexpr (checks::detail::use_builtins<LhsT>)
+    {
+        LhsT result;
+        const bool overflow = __builtin_add_overflow(lhs, rhs, &result);
+        return {result, overflow ? Error::Overflow : Error::None};
+    }
+    else
+        return {wrapping::Sum(lhs, rhs), checks::Sum(lhs, rhs) ? Error::Overflow : Error::None};
+}
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr Checked<LhsT> TrySub(const LhsT &lhs, const RhsT &rhs) noexcept
+{
+    if constexpr (checks::detail::use_asm<LhsT, RhsT>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            LhsT result = lhs;
+            const bool overflow = checks::detail::Asm<LhsT>::Sub(result, static_cast<LhsT>(rhs));
+            return {result, overflow ? Error::Overflow : Error::None};
+        }
+    }
+
+    if constexpr (checks::detail::use_builtins<LhsT>)
+    {
+        LhsT result;
+        const bool overflow = __builtin_sub_overflow(lhs, rhs, &result);
+        return {result, overflow ? Error::Overflow : Error::None};
+    }
+    else
+        return {wrapping::Sub(lhs, rhs), checks::Sub(lhs, rhs) ? Error::Overflow : Error::None};
+}
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr Checked<LhsT> TryMul(const LhsT &lhs, const RhsT &rhs) noexcept
+{
+    if constexpr (checks::detail::use_asm<LhsT, RhsT>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            LhsT result = lhs;
+            const bool overflow = checks::detail::Asm<LhsT>::Mul(result, static_cast<LhsT>(rhs));
+            return {result, overflow ? Error::Overflow : Error::None};
+        }
+    }
+
+    if constexpr (checks::detail::use_builtins<LhsT>)
+    {
+        LhsT result;
+        const bool overflow = __builtin_mul_overflow(lhs, rhs, &result);
+        return {result, overflow ? Error::Overflow : Error::None};
+    }
+    else
+        return {wrapping::Mul(lhs, rhs), checks::Mul(lhs, rhs) ? Error::Overflow : Error::None};
+}
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr Checked<LhsT> TryDiv(const LhsT &lhs, const RhsT &rhs) noexcept
+{
+    if (rhs == 0)
+        return {lhs, Error::DivisionByZero};
+    // min / -1 wraps around to min
+    if (checks::Div(lhs, rhs))
+        return {lhs, Error::Overflow};
+    return {wrapping::Div(lhs, rhs), Error::None};
+}
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr Checked<LhsT> TryAssign(const RhsT &rhs) noexcept
+{
+    return {wrapping::Assign<LhsT>(rhs),
+            checks::Assign<LhsT, RhsT>(rhs) ? Error::Overflow : Error::None};
+}
+
+} // namespace overflow
+
+#endif // #ifndef OVERFLOWWRAPPER_SRC_CHECKED_HPP
@@ -0,0 +1,147 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file digits.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides table-driven decimal formatting of integers.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_SRC_DIGITS_HPP
+#define OVERFLOWWRAPPER_SRC_DIGITS_HPP
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+
+
+
+namespace overflow::digits
+{
+
+/* -------------------------------------------------------------------------- */
+/*                                   Tables                                   */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief "00" to "99", so that two digits are produced per division.
+ */
+inline constexpr char pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/**
+ * @brief Powers of ten that fit in 64 bits.
+ */
+inline constexpr auto powers = []
+{
+    std::array<std::uint64_t, 20> pows{};
+    std::uint64_t pow = 1;
+    for (auto &p : pows)
+    {
+        p = pow;
+        pow *= 10;
+    }
+    return pows;
+}();
+
+
+
+
+
+/* -------------------------------------------------------------------------- */
+/*                             Formatting functions                           */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief Counts the decimal digits of an unsigned integer.
+ *
+ * @tparam U Unsigned integral type, at most 64 bits wide
+ * @param val Value
+ * @return Number of digits, 1 for zero
+ */
+template <std::unsigned_integral U>
+[[nodiscard]] constexpr int Count(const U &val)
+{
+    static_assert(sizeof(U) <= sizeof(std::uint64_t));
+
+    // Setting the lowest bit never changes the digit count but maps zero to
+    // one. log10(2) ~ 1233 / 4096
+    const U odd = val | 1u;
+    const int guess = std::bit_width(odd) * 1233 >> 12;
+    return guess + (odd >= powers[guess]);
+}
+
+/**
+ * @brief Writes the decimal digits of an unsigned integer ending right before
+ *        last.
+ *
+ * @tparam U Unsigned integral type
+ * @param last One past where the last digit goes
+ * @param val Value
+ */
+template <std::unsigned_integral U>
+constexpr void Write(char *last, U val)
+{
+    while (val >= 100)
+    {
+        const auto idx = static_cast<unsigned>(val % 100) * 2;
+        val /= 100;
+        *--last = pairs[idx + 1];
+        *--last = pairs[idx];
+    }
+
+    if (val >= 10)
+    {
+        const auto idx = static_cast<unsigned>(val) * 2;
+        *--last = pairs[idx + 1];
+        *--last = pairs[idx];
+    }
+    else
+        *--last = static_cast<char>('0' + val);
+}
+
+/**
+ * @brief Maximum number of characters an integer of type T formats to,
+ *        including the sign. The minimum of a signed type has as many digits
+ *        as the maximum, which also covers bool.
+ */
+template <std::integral T>
+inline constexpr int max_chars = Count(
+    static_cast<std::uint64_t>(std::numeric_limits<T>::max())) + std::is_signed_v<T>;
+
+} // namespace overflow::digits
+
+#endif // #ifndef OVERFLOWWRAPPER_SRC_DIGITS_HPP
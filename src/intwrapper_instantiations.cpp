@@ -0,0 +1,34 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file intwrapper_instantiations.cpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Defines the explicit instantiations declared by
+ *          intwrapper_extern.hpp.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Link this file into programs built with OVERFLOWWRAPPER_EXTERN_TEMPLATES
+ * defined.
+ */
+
+#ifndef OVERFLOWWRAPPER_EXTERN_TEMPLATES
+#define OVERFLOWWRAPPER_EXTERN_TEMPLATES
+#endif
+#define OVERFLOWWRAPPER_EXTERN_TEMPLATE template
+
+#include "../include/intwrapper.hpp"
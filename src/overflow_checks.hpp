@@ -29,8 +29,44 @@
 #ifndef OVERFLOWWRAPPER_SRC_OVERFLOW_CHECKS_HPP
 #define OVERFLOWWRAPPER_SRC_OVERFLOW_CHECKS_HPP
 
+#include <bit>
 #include <concepts>
+#include <cstddef>
 #include <limits>
+#include <type_traits>
+
+// Backends of the addition, subtraction and multiplication checks, selected
+// by defining OVERFLOWWRAPPER_BACKEND to one of them. The portable one is
+// plain C++; the builtin one uses the compilers' __builtin_*_overflow, and
+// the asm one inline assembly that reads the flags of the operation, on
+// x86-64 and AArch64. Both also give the wrapped result of the Try*
+// functions. The asm backend only handles operands whose right-hand side
+// always fits in the left-hand type, and isn't used in constant evaluation,
+// where the portable checks run. On AArch64, it also provides NEON kernels
+// for the element-wise operations of CheckedColumn.
+#define OVERFLOWWRAPPER_BACKEND_PORTABLE 0
+#define OVERFLOWWRAPPER_BACKEND_BUILTIN 1
+#define OVERFLOWWRAPPER_BACKEND_ASM 2
+
+#ifndef OVERFLOWWRAPPER_BACKEND
+#define OVERFLOWWRAPPER_BACKEND OVERFLOWWRAPPER_BACKEND_PORTABLE
+#endif
+
+#if OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_BUILTIN && !defined(__GNUC__)
+#error "The builtin backend needs GCC or Clang"
+#elif OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_ASM && !defined(__x86_64__) && !defined(__aarch64__)
+#error "No asm backend for this target"
+#elif OVERFLOWWRAPPER_BACKEND != OVERFLOWWRAPPER_BACKEND_PORTABLE \
+    && OVERFLOWWRAPPER_BACKEND != OVERFLOWWRAPPER_BACKEND_BUILTIN \
+    && OVERFLOWWRAPPER_BACKEND != OVERFLOWWRAPPER_BACKEND_ASM
+#error "Unknown OVERFLOWWRAPPER_BACKEND"
+#endif
+
+#if OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_ASM && defined(__x86_64__)
+#include "asm_x86_64.hpp"
+#elif OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_ASM
+#include "asm_aarch64.hpp"
+#endif
 
 
 
@@ -39,13 +75,148 @@
 namespace overflow::checks
 {
 
+/* -------------------------------------------------------------------------- */
+/*                                  Helpers                                   */
+/* -------------------------------------------------------------------------- */
+
+namespace detail
+{
+
+/**
+ * @brief Compares two integers by value like std::cmp_less, but also accepts
+ *        character and bool types.
+ */
+template <std::integral A, std::integral B>
+[[nodiscard]] constexpr bool Less(const A &a, const B &b)
+{
+    if constexpr (std::is_signed_v<A> == std::is_signed_v<B>)
+        return a < b;
+    else if constexpr (std::is_signed_v<A>)
+        return a < 0 || static_cast<std::make_unsigned_t<A>>(a) < b;
+    else
+        return b >= 0 && a < static_cast<std::make_unsigned_t<B>>(b);
+}
+
+/**
+ * @brief Unsigned type with the width of T, unsigned char for bool, which
+ *        std::make_unsigned doesn't take.
+ */
+template <std::integral T>
+using Unsigned = typename std::conditional_t<std::is_same_v<T, bool>, std::type_identity<unsigned char>,
+                                             std::make_unsigned<T>>::type;
+
+/**
+ * @brief Checks if a value is negative, without comparing unsigned values
+ *        against zero.
+ */
+template <std::integral T>
+[[nodiscard]] constexpr bool IsNegative(const T &val)
+{
+    if constexpr (std::is_signed_v<T>)
+        return val < 0;
+    else
+        return false;
+}
+
+/**
+ * @brief Gets the absolute value of an integer as the matching unsigned type,
+ *        which always holds it.
+ */
+template <std::integral T>
+[[nodiscard]] constexpr Unsigned<T> Magnitude(const T &val)
+{
+    using U = Unsigned<T>;
+    return IsNegative(val) ? static_cast<U>(U{0} - static_cast<U>(val))
+                           : static_cast<U>(val);
+}
+
+/**
+ * @brief Distance from a value up to the maximum of its type. Exact even for
+ *        negative values, since the modular difference is below 2^N.
+ */
+template <std::integral T>
+[[nodiscard]] constexpr Unsigned<T> RoomAbove(const T &val)
+{
+    using U = Unsigned<T>;
+    return static_cast<U>(static_cast<U>(std::numeric_limits<T>::max())
+                          - static_cast<U>(val));
+}
+
+/**
+ * @brief Distance from a value down to the minimum of its type.
+ */
+template <std::integral T>
+[[nodiscard]] constexpr Unsigned<T> RoomBelow(const T &val)
+{
+    using U = Unsigned<T>;
+    return static_cast<U>(static_cast<U>(val)
+                          - static_cast<U>(std::numeric_limits<T>::min()));
+}
+
+#ifdef __SIZEOF_INT128__
+__extension__ using UInt128 = unsigned __int128;
+#endif
+
+/**
+ * @brief Unsigned type that holds the product of two unsigned values of the
+ *        given total size, void if there is none.
+ */
+template <std::size_t Bytes>
+using WideUnsigned = std::conditional_t<
+    Bytes <= sizeof(unsigned), unsigned,
+    std::conditional_t<Bytes <= sizeof(unsigned long long), unsigned long long,
+#ifdef __SIZEOF_INT128__
+                       std::conditional_t<Bytes <= sizeof(UInt128), UInt128, void>
+#else
+                       void
+#endif
+                       >>;
+
+/**
+ * @brief Whether operations with a result of type T are checked with the
+ *        compilers' overflow builtins, which don't take bool results.
+ */
+template <typename T>
+inline constexpr bool use_builtins
+    = OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_BUILTIN && !std::is_same_v<T, bool>;
+
+/**
+ * @brief Whether operations on LhsT and RhsT are checked with inline
+ *        assembly, outside constant evaluation. The instructions take
+ *        operands of the same type, so rhs must convert to LhsT unchanged.
+ */
+template <typename LhsT, typename RhsT>
+inline constexpr bool use_asm
+    = OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_ASM && !std::is_same_v<LhsT, bool>
+      && !std::is_same_v<RhsT, bool> && !Less(std::numeric_limits<RhsT>::min(), std::numeric_limits<LhsT>::min())
+      && !Less(std::numeric_limits<LhsT>::max(), std::numeric_limits<RhsT>::max());
+
+/**
+ * @brief Operations of the asm backend on operands of type T, defined by the
+ *        header of the target: static bool Add, Sub and Mul(T &lhs, const T
+ *        &rhs), which store the wrapped result in lhs and return whether it
+ *        overflowed.
+ */
+template <std::integral T>
+struct Asm;
+
+} // namespace detail
+
+
+
+
+
 /* -------------------------------------------------------------------------- */
 /*                         Overflow checking functions                        */
 /* -------------------------------------------------------------------------- */
 
+// Each check dispatches on the signedness of the operands at compile time and
+// tests whether the mathematical result fits in LhsT, so mixed-signedness
+// operands aren't subject to the usual arithmetic conversions.
+
 /**
  * @brief Checks if a subtraction causes integer overflow.
- *        Should work in the vast majority of implementations.
+ *        Should work in any implementation.
  *
  * @tparam LhsT Left-hand operand's integral type
  * @tparam RhsT Right-hand operand's integral type
@@ -57,8 +228,33 @@ namespace overflow::checks
 template <std::integral LhsT, std::integral RhsT>
 [[nodiscard]] constexpr bool Sub(const LhsT &lhs, const RhsT &rhs)
 {
-    return (rhs < 0 && lhs > std::numeric_limits<LhsT>::max() + rhs
-            || rhs > 0 && lhs < std::numeric_limits<LhsT>::min() + rhs);
+    using Limits = std::numeric_limits<LhsT>;
+
+    if constexpr (detail::use_asm<LhsT, RhsT>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            LhsT result = lhs;
+            return detail::Asm<LhsT>::Sub(result, static_cast<LhsT>(rhs));
+        }
+    }
+
+    if constexpr (detail::use_builtins<LhsT>)
+    {
+        LhsT result;
+        return __builtin_sub_overflow(lhs, rhs, &result);
+    }
+    else if constexpr (std::is_unsigned_v<LhsT> && std::is_unsigned_v<RhsT>)
+        // Borrow
+        return rhs > lhs;
+    else if constexpr (std::is_signed_v<LhsT> && std::is_signed_v<RhsT>)
+        // Computed in the wider type, neither side can overflow
+        return rhs >= 0 ? lhs < Limits::min() + rhs : lhs > Limits::max() + rhs;
+    else if constexpr (std::is_signed_v<LhsT>)
+        return rhs > detail::RoomBelow(lhs);
+    else
+        return rhs >= 0 ? static_cast<std::make_unsigned_t<RhsT>>(rhs) > lhs
+                        : detail::Magnitude(rhs) > detail::RoomAbove(lhs);
 }
 
 
@@ -67,7 +263,7 @@ template <std::integral LhsT, std::integral RhsT>
 
 /**
  * @brief Checks if an addition causes integer overflow.
- *        Should work in the vast majority of implementations.
+ *        Should work in any implementation.
  *
  * @tparam LhsT Left-hand operand's integral type
  * @tparam RhsT Right-hand operand's integral type
@@ -79,16 +275,38 @@ template <std::integral LhsT, std::integral RhsT>
 template <std::integral LhsT, std::integral RhsT>
 [[nodiscard]] constexpr bool Sum(const LhsT &lhs, const RhsT &rhs)
 {
-    if (rhs < 0)
+    using Limits = std::numeric_limits<LhsT>;
+
+    if constexpr (detail::use_asm<LhsT, RhsT>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            LhsT result = lhs;
+            return detail::Asm<LhsT>::Add(result, static_cast<LhsT>(rhs));
+        }
+    }
+
+    if constexpr (detail::use_builtins<LhsT>)
+    {
+        LhsT result;
+        return __builtin_add_overflow(lhs, rhs, &result);
+    }
+    else if constexpr (std::is_unsigned_v<LhsT> && std::is_unsigned_v<RhsT>)
     {
-        if (rhs == std::numeric_limits<RhsT>::min())
-            // Possible overflow when sign is flipped
-            return true;
-        return Sub(lhs, -rhs);
+        // Carry, when rhs can't be truncated
+        if constexpr (sizeof(RhsT) <= sizeof(LhsT))
+            return static_cast<LhsT>(lhs + rhs) < lhs;
+        else
+            return rhs > detail::RoomAbove(lhs);
     }
-    if (lhs >= 0)
-        return std::numeric_limits<LhsT>::max() - lhs < rhs;
-    return std::numeric_limits<LhsT>::max() - rhs < lhs;
+    else if constexpr (std::is_signed_v<LhsT> && std::is_signed_v<RhsT>)
+        // Computed in the wider type, neither side can overflow
+        return rhs >= 0 ? lhs > Limits::max() - rhs : lhs < Limits::min() - rhs;
+    else if constexpr (std::is_signed_v<LhsT>)
+        return rhs > detail::RoomAbove(lhs);
+    else
+        return rhs >= 0 ? static_cast<std::make_unsigned_t<RhsT>>(rhs) > detail::RoomAbove(lhs)
+                        : detail::Magnitude(rhs) > lhs;
 }
 
 
@@ -97,7 +315,8 @@ template <std::integral LhsT, std::integral RhsT>
 
 /**
  * @brief Checks if a multiplication causes integer overflow.
- *        Should work in the vast majority of implementations.
+ *        Should work in any implementation, without divisions when a type
+ *        twice as wide as the operands is available.
  *
  * @tparam LhsT Left-hand operand's integral type
  * @tparam RhsT Right-hand operand's integral type
@@ -109,28 +328,118 @@ template <std::integral LhsT, std::integral RhsT>
 template <std::integral LhsT, std::integral RhsT>
 [[nodiscard]] constexpr bool Mul(const LhsT &lhs, const RhsT &rhs)
 {
-    // TODO: Use a better algorithm
+    using UL = detail::Unsigned<LhsT>;
+    using Wide = detail::WideUnsigned<sizeof(LhsT) + sizeof(RhsT)>;
 
-    if (lhs == 0 || rhs == 0)
-        return false;
+    if constexpr (detail::use_asm<LhsT, RhsT>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            LhsT result = lhs;
+            return detail::Asm<LhsT>::Mul(result, static_cast<LhsT>(rhs));
+        }
+    }
+
+    if constexpr (detail::use_builtins<LhsT>)
+    {
+        LhsT result;
+        return __builtin_mul_overflow(lhs, rhs, &result);
+    }
+
+    const auto l = detail::Magnitude(lhs);
+    const auto r = detail::Magnitude(rhs);
+    UL limit = std::numeric_limits<LhsT>::max();
 
-    if (lhs < 0)
+    if constexpr (!std::is_unsigned_v<LhsT> || !std::is_unsigned_v<RhsT>)
     {
-        if (rhs < 0)
+        if (detail::IsNegative(lhs) != detail::IsNegative(rhs))
         {
-            if (lhs == std::numeric_limits<LhsT>::min()
-                || rhs == std::numeric_limits<LhsT>::min())
-            {
-                return true;
-            }
-            return Mul(-lhs, -rhs);
+            // Negative products reach one further in signed types, and
+            // nowhere but zero in unsigned ones
+            if constexpr (std::is_signed_v<LhsT>)
+                ++limit;
+            else
+                return l != 0 && r != 0;
         }
-        else
-            return std::numeric_limits<LhsT>::min() / lhs < rhs;
     }
-    if (rhs < 0)
-        return std::numeric_limits<LhsT>::min() / rhs < lhs;
-    return std::numeric_limits<LhsT>::max() / lhs < rhs;
+
+    if constexpr (!std::is_void_v<Wide>)
+        return static_cast<Wide>(l) * static_cast<Wide>(r) > limit;
+    else
+        return r != 0 && l > limit / r;
+}
+
+/**
+ * @brief Closed range of values of an integral type.
+ */
+template <std::integral T>
+struct Range
+{
+    T low;
+    T high;
+
+    [[nodiscard]] constexpr bool Contains(const T &val) const
+    {
+        return val >= low && val <= high;
+    }
+};
+
+/**
+ * @brief Gets the left-hand operands whose product with rhs doesn't overflow,
+ *        so that multiplying many values by the same rhs is checked with two
+ *        comparisons each instead of a multiplication or division.
+ *        Should work in any implementation.
+ *
+ * @tparam LhsT Left-hand operand's integral type
+ * @tparam RhsT Right-hand operand's integral type
+ * @param rhs Right-hand operand
+ * @return Range of lhs for which Mul(lhs, rhs) is false
+ */
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr Range<LhsT> MulRange(const RhsT &rhs)
+{
+    using Limits = std::numeric_limits<LhsT>;
+    using U = std::make_unsigned_t<std::common_type_t<LhsT, RhsT, unsigned>>;
+
+    if (rhs == 0)
+        return {Limits::min(), Limits::max()};
+
+    const U r = detail::Magnitude(rhs);
+    const U max = static_cast<U>(Limits::max());
+    const U below = detail::Magnitude(Limits::min());
+
+    // Magnitudes that reach the limits of LhsT: up to the maximum for
+    // positive products, the minimum for negative ones. Quotients truncate
+    // toward zero, which keeps them inside the limits.
+    const U up = (detail::IsNegative(rhs) ? below : max) / r;
+    const U down = (detail::IsNegative(rhs) ? max : below) / r;
+
+    if constexpr (std::is_signed_v<LhsT>)
+        return {static_cast<LhsT>(U{0} - down), static_cast<LhsT>(up < max ? up : max)};
+    else
+        return {0, static_cast<LhsT>(up)};
+}
+
+
+
+
+
+/**
+ * @brief Checks if a multiplication by a compile-time constant causes integer
+ *        overflow. Compares against two precomputed thresholds, so e.g. unit
+ *        conversions cost no multiplication or division.
+ *
+ * @tparam K Right-hand operand, a constant of any integral type
+ * @tparam LhsT Left-hand operand's integral type
+ * @param lhs Left-hand operand
+ * @return true Causes integer overflow
+ * @return false Does not cause integer overflow
+ */
+template <auto K, std::integral LhsT>
+[[nodiscard]] constexpr bool Mul(const LhsT &lhs)
+{
+    constexpr Range<LhsT> range = MulRange<LhsT>(K);
+    return lhs > range.high || lhs < range.low;
 }
 
 
@@ -139,7 +448,7 @@ template <std::integral LhsT, std::integral RhsT>
 
 /**
  * @brief Checks if a division causes integer overflow.
- *        Should work in the vast majority of implementations.
+ *        Should work in any implementation.
  *
  * @tparam LhsT Left-hand operand's integral type
  * @tparam RhsT Right-hand operand's integral type
@@ -151,9 +460,70 @@ template <std::integral LhsT, std::integral RhsT>
 template <std::integral LhsT, std::integral RhsT>
 [[nodiscard]] constexpr bool Div(const LhsT &lhs, const RhsT &rhs)
 {
-    // TODO: Implement
+    // Quotients are never larger than the dividend, except for min / -1 and
+    // negative quotients in unsigned types.
+    // Division by zero isn't an overflow and isn't checked here.
+    if constexpr (std::is_signed_v<LhsT> && std::is_signed_v<RhsT>)
+        return rhs == -1 && lhs == std::numeric_limits<LhsT>::min();
+    else if constexpr (std::is_unsigned_v<LhsT> && std::is_signed_v<RhsT>)
+        return rhs < 0 && detail::Magnitude(rhs) <= lhs;
+    else
+        return false;
+}
+
+
+
+
+
+/**
+ * @brief Checks if a left shift loses set bits or changes the sign, or if the
+ *        shift count is negative or not less than the width of LhsT.
+ *        Should work in any implementation.
+ *
+ * @tparam LhsT Left-hand operand's integral type
+ * @tparam RhsT Right-hand operand's integral type
+ * @param lhs Left-hand operand
+ * @param rhs Shift count
+ * @return true Causes integer overflow
+ * @return false Does not cause integer overflow
+ */
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr bool Shl(const LhsT &lhs, const RhsT &rhs)
+{
+    using U = std::make_unsigned_t<LhsT>;
+
+    if (detail::Less(rhs, 0) || !detail::Less(rhs, std::numeric_limits<U>::digits))
+        return true;
+
+    // The shifted out bits and the new sign bit must all equal the old sign
+    // bit, the leading run of copies of it must be longer than the count
+    const U bits = static_cast<U>(lhs);
+    if constexpr (std::is_signed_v<LhsT>)
+        return !detail::Less(rhs, lhs < 0 ? std::countl_one(bits) : std::countl_zero(bits));
+    else
+        return detail::Less(std::countl_zero(bits), rhs);
+}
+
+/**
+ * @brief Checks if a left shift by a compile-time count loses set bits or
+ *        changes the sign. Compares against two precomputed thresholds.
+ *
+ * @tparam Count Shift count, must be less than the width of LhsT
+ * @tparam LhsT Left-hand operand's integral type
+ * @param lhs Left-hand operand
+ * @return true Causes integer overflow
+ * @return false Does not cause integer overflow
+ */
+template <auto Count, std::integral LhsT>
+[[nodiscard]] constexpr bool Shl(const LhsT &lhs)
+{
+    static_assert(!detail::Less(Count, 0)
+                  && detail::Less(Count, std::numeric_limits<std::make_unsigned_t<LhsT>>::digits),
+                  "Shift count out of range");
 
-    return false;
+    constexpr LhsT high = std::numeric_limits<LhsT>::max() >> Count;
+    constexpr LhsT low = std::numeric_limits<LhsT>::min() >> Count;
+    return lhs > high || lhs < low;
 }
 
 
@@ -161,12 +531,91 @@ template <std::integral LhsT, std::integral RhsT>
 
 
 /**
- * @brief Checks if an assignment causes integer overflow.
+ * @brief Checks if a right shift count is negative or not less than the width
+ *        of LhsT. Right shifts can't overflow otherwise.
  *        Should work in any implementation.
  *
  * @tparam LhsT Left-hand operand's integral type
  * @tparam RhsT Right-hand operand's integral type
  * @param lhs Left-hand operand
+ * @param rhs Shift count
+ * @return true Causes integer overflow
+ * @return false Does not cause integer overflow
+ */
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr bool Shr(const LhsT &, const RhsT &rhs)
+{
+    return detail::Less(rhs, 0)
+           || !detail::Less(rhs, std::numeric_limits<std::make_unsigned_t<LhsT>>::digits);
+}
+
+
+
+
+
+/**
+ * @brief Checks if an increment causes integer overflow.
+ *        Should work in any implementation.
+ *
+ * @tparam T Operand's integral type
+ * @param val Operand
+ * @return true Causes integer overflow
+ * @return false Does not cause integer overflow
+ */
+template <std::integral T>
+[[nodiscard]] constexpr bool Inc(const T &val)
+{
+    return val == std::numeric_limits<T>::max();
+}
+
+/**
+ * @brief Checks if a decrement causes integer overflow.
+ *        Should work in any implementation.
+ *
+ * @tparam T Operand's integral type
+ * @param val Operand
+ * @return true Causes integer overflow
+ * @return false Does not cause integer overflow
+ */
+template <std::integral T>
+[[nodiscard]] constexpr bool Dec(const T &val)
+{
+    return val == std::numeric_limits<T>::min();
+}
+
+/**
+ * @brief Checks if a negation causes integer overflow.
+ *        Should work in any implementation.
+ *
+ * @tparam T Operand's integral type
+ * @param val Operand
+ * @return true Causes integer overflow
+ * @return false Does not cause integer overflow
+ */
+template <std::integral T>
+[[nodiscard]] constexpr bool Neg(const T &val)
+{
+    // Only zero can be negated in an unsigned type
+    if constexpr (std::is_signed_v<T>)
+        return val == std::numeric_limits<T>::min();
+    else
+        return val != 0;
+}
+
+
+
+
+
+/**
+ * @brief Checks if an assignment causes integer overflow.
+ *        Should work in any implementation.
+ *
+ * Compiles to nothing when every RhsT fits in LhsT, to a single comparison
+ * against the limit that can be crossed when only one can, and to a single
+ * unsigned range comparison otherwise.
+ *
+ * @tparam LhsT Left-hand operand's integral type
+ * @tparam RhsT Right-hand operand's integral type
  * @param rhs Right-hand operand
  * @return true Causes integer overflow
  * @return false Does not cause integer overflow
@@ -174,8 +623,163 @@ template <std::integral LhsT, std::integral RhsT>
 template <std::integral LhsT, std::integral RhsT>
 [[nodiscard]] constexpr bool Assign(const RhsT &rhs)
 {
-    return rhs > std::numeric_limits<LhsT>::max()
-           || rhs < std::numeric_limits<LhsT>::min();
+    using LhsLimits = std::numeric_limits<LhsT>;
+    using RhsLimits = std::numeric_limits<RhsT>;
+
+    constexpr bool min_fits = !detail::Less(RhsLimits::min(), LhsLimits::min());
+    constexpr bool max_fits = !detail::Less(LhsLimits::max(), RhsLimits::max());
+
+    if constexpr (min_fits && max_fits)
+        return false;
+    else if constexpr (min_fits)
+        return detail::Less(LhsLimits::max(), rhs);
+    else if constexpr (max_fits)
+        return detail::Less(rhs, LhsLimits::min());
+    else
+    {
+        // Only a wider signed RhsT crosses both limits. Shifting the range so
+        // that LhsT's minimum maps to zero makes values below it wrap around
+        // to huge unsigned values
+        using U = std::make_unsigned_t<RhsT>;
+        constexpr U low = static_cast<U>(static_cast<RhsT>(LhsLimits::min()));
+        constexpr U span = static_cast<U>(static_cast<U>(static_cast<RhsT>(LhsLimits::max())) - low);
+        return static_cast<U>(static_cast<U>(rhs) - low) > span;
+    }
+}
+
+
+
+
+
+/* -------------------------------------------------------------------------- */
+/*                                  Dispatch                                  */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief Identifies a checked operation.
+ */
+enum class Operation
+{
+    Assign,
+    Sum,
+    Sub,
+    Mul,
+    Div,
+    Shl,
+    Shr,
+    Inc,
+    Dec,
+    Neg,
+
+    // Functions checked without the policy, only reported through Bypass
+    Pow,
+    Factorial,
+    Binomial,
+    Gcd,
+    Lcm
+};
+
+/**
+ * @brief Gets the name of an operation.
+ *
+ * @param o Operation
+ * @return Lowercase name, same as the enumerator's
+ */
+[[nodiscard]] constexpr const char *Name(Operation o)
+{
+    switch (o)
+    {
+    case Operation::Assign: return "assign";
+    case Operation::Sum: return "sum";
+    case Operation::Sub: return "sub";
+    case Operation::Mul: return "mul";
+    case Operation::Div: return "div";
+    case Operation::Shl: return "shl";
+    case Operation::Shr: return "shr";
+    case Operation::Inc: return "inc";
+    case Operation::Dec: return "dec";
+    case Operation::Neg: return "neg";
+    case Operation::Pow: return "pow";
+    case Operation::Factorial: return "factorial";
+    case Operation::Binomial: return "binomial";
+    case Operation::Gcd: return "gcd";
+    case Operation::Lcm: return "lcm";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Runs the check of an operation selected at compile time.
+ *
+ * @tparam O Operation
+ * @tparam LhsT Left-hand operand's integral type
+ * @tparam RhsT Right-hand operand's integral type
+ * @param lhs Left-hand operand, ignored by Operation::Assign
+ * @param rhs Right-hand operand, ignored by the unary operations
+ * @return true Causes integer overflow
+ * @return false Does not cause integer overflow
+ */
+template <Operation O, std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr bool Run(const LhsT &lhs, const RhsT &rhs)
+{
+    if constexpr (O == Operation::Assign)
+        return Assign<LhsT, RhsT>(rhs);
+    else if constexpr (O == Operation::Sum)
+        return Sum(lhs, rhs);
+    else if constexpr (O == Operation::Sub)
+        return Sub(lhs, rhs);
+    else if constexpr (O == Operation::Mul)
+        return Mul(lhs, rhs);
+    else if constexpr (O == Operation::Div)
+        return Div(lhs, rhs);
+    else if constexpr (O == Operation::Shl)
+        return Shl(lhs, rhs);
+    else if constexpr (O == Operation::Shr)
+        return Shr(lhs, rhs);
+    else if constexpr (O == Operation::Inc)
+        return Inc(lhs);
+    else if constexpr (O == Operation::Dec)
+        return Dec(lhs);
+    else
+    {
+        static_assert(O == Operation::Neg, "Operation can't be checked by operands");
+        return Neg(lhs);
+    }
+}
+
+
+
+
+
+/* -------------------------------------------------------------------------- */
+/*                                  Headroom                                  */
+/* -------------------------------------------------------------------------- */
+
+/**
+ * @brief Computes how many times a value can be doubled before it overflows
+ *        its type.
+ *
+ * @tparam T Integral type
+ * @param val Value
+ * @return Number of value bits left unused by val, 0 meaning that val is
+ *         within a factor of two of a limit of T
+ */
+template <std::integral T>
+[[nodiscard]] constexpr int HeadroomBits(const T &val)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        // Its single value bit, with no unsigned counterpart
+        return !val;
+    }
+    else
+    {
+        using U = std::make_unsigned_t<T>;
+
+        // ~val maps [min, -1] to [0, max], which take as many bits as [0, max]
+        const U magnitude = static_cast<U>(val < 0 ? ~val : val);
+        return std::numeric_limits<T>::digits - std::bit_width(magnitude);
+    }
 }
 
 } // namespace overflow::checks
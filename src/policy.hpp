@@ -0,0 +1,185 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file policy.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides the basic overflow policies of IntWrapper.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * A policy decides how IntWrapper checks its operations and what happens on
+ * overflow. It is a class with the static members
+ *
+ *  - template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+ *    constexpr bool Check(const LhsT &lhs, const RhsT &rhs,
+ *                         const std::source_location &where)
+ *
+ *    Returns whether the operation overflows. Returning false for an
+ *    operation that overflows makes it wrap around.
+ *
+ *  - constexpr void Bypass(checks::Operation o,
+ *                          const std::source_location &where)
+ *
+ *    Called instead of Check by operations checked without the policy, like
+ *    shifts by a compile-time count or CheckedPow, whose operands aren't
+ *    those of a single operation.
+ *
+ *  - template <std::integral T>
+ *    constexpr void Result(checks::Operation o, const T &result,
+ *                          const std::source_location &where)
+ *
+ *    Called with the new value after every operation that doesn't overflow.
+ *
+ *  - [[noreturn]] void Overflow(const char *what,
+ *                               const std::source_location &where)
+ *
+ *    Called when Check returns true, or an operation checked without the
+ *    policy overflows.
+ *
+ * Each operation calls either Check or Bypass, then either Result or Overflow.
+ *
+ * where is the location of the caller for the named operations (Add, Sub...),
+ * constructors, assignments, compound assignments and increments, and the
+ * location of the operator itself for the binary operators, unary minus and
+ * the compound assignments by a std::integral_constant.
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_SRC_POLICY_HPP
+#define OVERFLOWWRAPPER_SRC_POLICY_HPP
+
+#include <concepts>
+#include <cstdio>
+#include <cstdlib>
+#include <source_location>
+#include <stdexcept>
+
+#include "overflow_checks.hpp"
+
+
+
+
+
+namespace overflow::detail
+{
+
+/**
+ * @brief Reports arguments that break a precondition, like spans of different
+ *        sizes, by throwing std::invalid_argument, or by printing the message
+ *        and aborting if exceptions are disabled.
+ */
+[[noreturn]] inline void InvalidArgument(const char *what)
+{
+#ifdef __cpp_exceptions
+    throw std::invalid_argument(what);
+#else
+    std::fputs(what, stderr);
+    std::fputc('\n', stderr);
+    std::abort();
+#endif
+}
+
+} // namespace overflow::detail
+
+namespace overflow::policy
+{
+
+/**
+ * @brief Checks every operation and throws std::overflow_error on overflow,
+ *        or aborts if exceptions are disabled.
+ */
+struct Throw
+{
+    template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+    [[nodiscard]] static constexpr bool Check(const LhsT &lhs, const RhsT &rhs,
+                                              const std::source_location &)
+    {
+        return checks::Run<O>(lhs, rhs);
+    }
+
+    static constexpr void Bypass(checks::Operation, const std::source_location &)
+    {
+    }
+
+    template <std::integral T>
+    static constexpr void Result(checks::Operation, const T &,
+                                 const std::source_location &)
+    {
+    }
+
+    [[noreturn]] static void Overflow(const char *what,
+                                      const std::source_location &)
+    {
+#ifdef __cpp_exceptions
+        throw std::overflow_error(what);
+#else
+        // Built with -fno-exceptions, use the Try* functions to recover
+        std::fputs(what, stderr);
+        std::fputc('\n', stderr);
+        std::abort();
+#endif
+    }
+};
+
+/**
+ * @brief Checks every operation and aborts on overflow, after printing the
+ *        message and location. Under a sanitizer or a fuzzer, the abort
+ *        reports the stack of the overflow.
+ */
+struct Abort
+{
+    template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+    [[nodiscard]] static constexpr bool Check(const LhsT &lhs, const RhsT &rhs,
+                                              const std::source_location &)
+    {
+        return checks::Run<O>(lhs, rhs);
+    }
+
+    static constexpr void Bypass(checks::Operation, const std::source_location &)
+    {
+    }
+
+    template <std::integral T>
+    static constexpr void Result(checks::Operation, const T &,
+                                 const std::source_location &)
+    {
+    }
+
+    [[noreturn]] static void Overflow(const char *what,
+                                      const std::source_location &where)
+    {
+        std::fprintf(stderr, "%s:%u: %s: %s\n", where.file_name(),
+                     static_cast<unsigned>(where.line()), where.function_name(), what);
+        std::abort();
+    }
+};
+
+// Policy of IntWrapper and of the checked functions when none is given,
+// selected by defining OVERFLOWWRAPPER_DEFAULT_POLICY to a policy of this
+// namespace. Every translation unit of a program must agree on it.
+#ifndef OVERFLOWWRAPPER_DEFAULT_POLICY
+#define OVERFLOWWRAPPER_DEFAULT_POLICY Throw
+#endif
+
+using Default = OVERFLOWWRAPPER_DEFAULT_POLICY;
+
+} // namespace overflow::policy
+
+#endif // #ifndef OVERFLOWWRAPPER_SRC_POLICY_HPP
@@ -0,0 +1,175 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file wrapping.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Provides integer arithmetic that wraps around instead of having
+ *          undefined behavior on overflow.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_SRC_WRAPPING_HPP
+#define OVERFLOWWRAPPER_SRC_WRAPPING_HPP
+
+#include <concepts>
+#include <limits>
+#include <type_traits>
+
+#include "overflow_checks.hpp"
+
+
+
+
+
+namespace overflow::wrapping
+{
+
+/**
+ * @brief Unsigned type at least as wide as both operands and as unsigned int,
+ *        so that no operand is promoted back to a signed type.
+ */
+template <std::integral LhsT, std::integral RhsT>
+using Unsigned = std::make_unsigned_t<std::common_type_t<LhsT, RhsT, unsigned>>;
+
+/* -------------------------------------------------------------------------- */
+/*                             Wrapping functions                             */
+/* -------------------------------------------------------------------------- */
+
+// Each function returns the result modulo the range of LhsT, which is the
+// exact result whenever the matching checks:: function reports no overflow.
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr LhsT Sum(const LhsT &lhs, const RhsT &rhs)
+{
+    using U = Unsigned<LhsT, RhsT>;
+    return static_cast<LhsT>(static_cast<U>(static_cast<U>(lhs) + static_cast<U>(rhs)));
+}
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr LhsT Sub(const LhsT &lhs, const RhsT &rhs)
+{
+    using U = Unsigned<LhsT, RhsT>;
+    return static_cast<LhsT>(static_cast<U>(static_cast<U>(lhs) - static_cast<U>(rhs)));
+}
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr LhsT Mul(const LhsT &lhs, const RhsT &rhs)
+{
+    using U = Unsigned<LhsT, RhsT>;
+    return static_cast<LhsT>(static_cast<U>(static_cast<U>(lhs) * static_cast<U>(rhs)));
+}
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr LhsT Div(const LhsT &lhs, const RhsT &rhs)
+{
+    if constexpr (std::is_signed_v<LhsT> == std::is_signed_v<RhsT>)
+    {
+        // The only quotient that doesn't fit is min / -1
+        if constexpr (std::is_signed_v<LhsT>)
+            if (rhs == -1)
+                return Sub(LhsT{0}, lhs);
+        return static_cast<LhsT>(lhs / rhs);
+    }
+    else
+    {
+        // Divide the magnitudes instead of letting the signed operand be
+        // converted to unsigned
+        using U = Unsigned<LhsT, RhsT>;
+        const U quotient = static_cast<U>(static_cast<U>(checks::detail::Magnitude(lhs))
+                                          / static_cast<U>(checks::detail::Magnitude(rhs)));
+        return checks::detail::IsNegative(lhs) != checks::detail::IsNegative(rhs)
+                   ? Sub(LhsT{0}, quotient)
+                   : static_cast<LhsT>(quotient);
+    }
+}
+
+// Shift counts are taken modulo the width of LhsT
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr LhsT Shl(const LhsT &lhs, const RhsT &rhs)
+{
+    using U = std::make_unsigned_t<std::common_type_t<LhsT, unsigned>>;
+    constexpr unsigned mask = std::numeric_limits<std::make_unsigned_t<LhsT>>::digits - 1;
+    return static_cast<LhsT>(static_cast<U>(static_cast<U>(lhs) << (rhs & mask)));
+}
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr LhsT Shr(const LhsT &lhs, const RhsT &rhs)
+{
+    constexpr unsigned mask = std::numeric_limits<std::make_unsigned_t<LhsT>>::digits - 1;
+    return static_cast<LhsT>(lhs >> (rhs & mask));
+}
+
+template <std::integral T>
+[[nodiscard]] constexpr T Neg(const T &val)
+{
+    using U = Unsigned<T, T>;
+    return static_cast<T>(static_cast<U>(U{0} - static_cast<U>(val)));
+}
+
+template <std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr LhsT Assign(const RhsT &rhs)
+{
+    return static_cast<LhsT>(rhs);
+}
+
+/**
+ * @brief Computes an operation selected at compile time.
+ *
+ * @tparam O Operation
+ * @param lhs Left-hand operand, ignored by checks::Operation::Assign
+ * @param rhs Right-hand operand, ignored by the unary operations
+ * @return Wrapped result
+ */
+template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+[[nodiscard]] constexpr LhsT Run(const LhsT &lhs, const RhsT &rhs)
+{
+    using checks::Operation;
+
+    if constexpr (O == Operation::Assign)
+        return Assign<LhsT, RhsT>(rhs);
+    else if constexpr (O == Operation::Sum)
+        return Sum(lhs, rhs);
+    else if constexpr (O == Operation::Sub)
+        return Sub(lhs, rhs);
+    else if constexpr (O == Operation::Mul)
+        return Mul(lhs, rhs);
+    else if constexpr (O == Operation::Div)
+        return Div(lhs, rhs);
+    else if constexpr (O == Operation::Shl)
+        return Shl(lhs, rhs);
+    else if constexpr (O == Operation::Shr)
+        return Shr(lhs, rhs);
+    else if constexpr (O == Operation::Inc)
+        return Sum(lhs, 1);
+    else if constexpr (O == Operation::Dec)
+        return Sub(lhs, 1);
+    else
+    {
+        static_assert(O == Operation::Neg, "Operation can't be computed from operands");
+        return Neg(lhs);
+    }
+}
+
+} // namespace overflow::wrapping
+
+#endif // #ifndef OVERFLOWWRAPPER_SRC_WRAPPING_HPP
@@ -0,0 +1,796 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file checks.cpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Randomized tests of the backend the program is built with, against
+ *          exact results computed in __int128.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Usage: checks [SEED [ITERATIONS]]
+ *
+ * Tests every operation on every pair of fixed-width types and with bool
+ * operands on the right, the column kernels of checked_column.hpp,
+ * CheckedHistogram, CheckedMatmul, Decimal, Rational, the functions of
+ * checked_math.hpp and DurationCast, with operands biased towards the
+ * limits. The literals and constants of compile_time.hpp are checked by
+ * static_asserts.
+ * Prints each mismatch with the seed that reproduces it and exits with a
+ * failure status if there was any.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <random>
+#include <ratio>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/checked_column.hpp"
+#include "../include/checked_histogram.hpp"
+#include "../include/checked_math.hpp"
+#include "../include/checked_matmul.hpp"
+#include "../include/compile_time.hpp"
+#include "../include/decimal.hpp"
+#include "../include/intwrapper_chrono.hpp"
+#include "../include/rational.hpp"
+#include "reference.hpp"
+
+
+
+
+
+namespace
+{
+
+using namespace overflow;
+using namespace overflow::test;
+
+constexpr const char *backend_name = OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_ASM       ? "asm"
+                                     : OVERFLOWWRAPPER_BACKEND == OVERFLOWWRAPPER_BACKEND_BUILTIN ? "builtin"
+                                                                                                  : "portable";
+
+std::uint64_t seed = 1;
+std::size_t failures = 0;
+
+/**
+ * @brief Random value of T: anything, small, or close to a limit.
+ */
+template <std::integral T>
+T Random(std::mt19937_64 &rng)
+{
+    using Limits = std::numeric_limits<T>;
+
+    const std::uint64_t r = rng();
+    switch (r % 4)
+    {
+    case 0: return static_cast<T>(r >> 2);
+    case 1: return static_cast<T>(static_cast<int>((r >> 2) % 140) - 70);
+    case 2: return static_cast<T>(Limits::max() - static_cast<T>((r >> 2) % 4));
+    default: return static_cast<T>(Limits::min() + static_cast<T>((r >> 2) % 4));
+    }
+}
+
+void Fail(const std::string &what, const std::string &detail)
+{
+    if (++failures <= 50)
+        std::printf("FAIL %s: %s (backend %s, seed %llu)\n", what.c_str(), detail.c_str(),
+                    backend_name, static_cast<unsigned long long>(seed));
+}
+
+template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+void TestOperation(std::mt19937_64 &rng, std::size_t iterations)
+{
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const LhsT lhs = Random<LhsT>(rng);
+        // Shift counts mostly in range
+        const RhsT rhs = O == checks::Operation::Shl || O == checks::Operation::Shr
+                             ? static_cast<RhsT>(rng() % 8 == 0 ? Random<RhsT>(rng) : static_cast<RhsT>(rng() % 64))
+                             : Random<RhsT>(rng);
+
+        const std::string mismatch = Verify<O>(lhs, rhs);
+        if (!mismatch.empty())
+            Fail(mismatch, std::string(checks::Name(O)) + '(' + ToString(lhs) + ", " + ToString(rhs) + ')');
+    }
+}
+
+template <std::integral LhsT, std::integral RhsT>
+void TestPair(std::mt19937_64 &rng, std::size_t iterations)
+{
+    using checks::Operation;
+
+    TestOperation<Operation::Assign, LhsT, RhsT>(rng, iterations);
+    TestOperation<Operation::Sum, LhsT, RhsT>(rng, iterations);
+    TestOperation<Operation::Sub, LhsT, RhsT>(rng, iterations);
+    TestOperation<Operation::Mul, LhsT, RhsT>(rng, iterations);
+    TestOperation<Operation::Div, LhsT, RhsT>(rng, iterations);
+    TestOperation<Operation::Shl, LhsT, RhsT>(rng, iterations);
+    TestOperation<Operation::Shr, LhsT, RhsT>(rng, iterations);
+}
+
+template <std::integral T>
+void TestUnary(std::mt19937_64 &rng, std::size_t iterations)
+{
+    using checks::Operation;
+
+    TestOperation<Operation::Inc, T, T>(rng, iterations);
+    TestOperation<Operation::Dec, T, T>(rng, iterations);
+    TestOperation<Operation::Neg, T, T>(rng, iterations);
+}
+
+/**
+ * @brief Checks a mutating column operation against the exact results of its
+ *        elements.
+ */
+template <std::integral T>
+void CheckColumn(const char *what, const BatchResult &result, const CheckedColumn<T> &column,
+                 const std::vector<Int128> &exact)
+{
+    std::size_t first = exact.size();
+    for (std::size_t i = 0; i < exact.size() && first == exact.size(); ++i)
+        if (!Fits<T>(exact[i]))
+            first = i;
+
+    if (result.overflow != (first != exact.size()) || result.first != first)
+        Fail(what, "first overflow " + std::to_string(result.first) + ", expected "
+                   + std::to_string(first) + " of " + std::to_string(exact.size()));
+
+    for (std::size_t i = 0; i < exact.size(); ++i)
+        if (column[i] != Wrap<T>(exact[i]))
+        {
+            Fail(what, "element " + std::to_string(i));
+            break;
+        }
+}
+
+template <std::integral T>
+void TestColumn(std::mt19937_64 &rng, std::size_t iterations)
+{
+    for (std::size_t i = 0; i < iterations / 64 + 1; ++i)
+    {
+        // Across several blocks, with a tail
+        const std::size_t n = rng() % 300;
+        std::vector<T> a(n);
+        std::vector<T> b(n);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            // Mostly small, so that most columns don't overflow at once
+            a[j] = rng() % 16 == 0 ? Random<T>(rng) : static_cast<T>(rng() % 100);
+            b[j] = rng() % 16 == 0 ? Random<T>(rng) : static_cast<T>(rng() % 100);
+        }
+        const T scalar = rng() % 4 == 0 ? Random<T>(rng) : static_cast<T>(rng() % 5);
+
+        std::vector<Int128> sum(n);
+        std::vector<Int128> diff(n);
+        std::vector<Int128> product(n);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            sum[j] = Int128{a[j]} + b[j];
+            diff[j] = Int128{a[j]} - b[j];
+            product[j] = Int128{a[j]} * scalar;
+        }
+
+        const CheckedColumn<T> rhs(b);
+
+        CheckedColumn<T> column(a);
+        const BatchResult added = column.Add(rhs);
+        CheckColumn("CheckedColumn::Add", added, column, sum);
+        if (column.Status().overflow != added.overflow || column.Status().first != added.first)
+            Fail("CheckedColumn::Status", "differs from the only operation");
+
+        column = CheckedColumn<T>(a);
+        CheckColumn("CheckedColumn::Sub", column.Sub(rhs), column, diff);
+
+        column = CheckedColumn<T>(a);
+        CheckColumn("CheckedColumn::Mul", column.Mul(scalar), column, product);
+
+        // Running sum, whose first exit from the range of T is reported
+        const BatchSum<T> total = CheckedColumn<T>(a).Sum();
+        Int128 running = 0;
+        std::size_t first = n;
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            running += a[j];
+            if (first == n && !Fits<T>(running))
+                first = j;
+        }
+        if (total.value != Wrap<T>(running) || total.status.overflow != (first != n)
+            || total.status.first != first)
+            Fail("CheckedColumn::Sum", "first overflow " + std::to_string(total.status.first)
+                                           + ", expected " + std::to_string(first));
+    }
+}
+
+/**
+ * @brief Checks CheckedHistogram against bins summed in __int128, with keys
+ *        of KeyT on both sides of the bins and weights near their limits.
+ */
+template <std::integral KeyT>
+void TestHistogram(std::mt19937_64 &rng, std::size_t iterations)
+{
+    for (std::size_t i = 0; i < iterations / 256 + 1; ++i)
+    {
+        const std::size_t n = rng() % 600;
+        // Also more bins than the values of an unsigned KeyT
+        const std::size_t bins = rng() % 4 == 0 ? 300 : rng() % 40 + 1;
+
+        std::vector<KeyT> keys(n);
+        std::vector<std::int32_t> weights(n);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            keys[j] = rng() % 32 == 0 ? Random<KeyT>(rng) : static_cast<KeyT>(rng() % bins);
+            weights[j] = Random<std::int32_t>(rng);
+        }
+
+        std::vector<Int128> counts(bins);
+        std::vector<Int128> sums(bins);
+        std::size_t invalid = n;
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            if (keys[j] < 0 || static_cast<std::uint64_t>(keys[j]) >= bins)
+            {
+                invalid = std::min(invalid, j);
+                continue;
+            }
+            counts[static_cast<std::size_t>(keys[j])] += 1;
+            sums[static_cast<std::size_t>(keys[j])] += weights[j];
+        }
+
+        // Split across threads on every other pass
+        const HistogramOptions options{static_cast<unsigned>(i % 2 * 3 + 1), 1};
+
+        const auto check = [&](const char *what, const auto &result, const std::vector<Int128> &exact)
+        {
+            using CountT = typename std::remove_cvref_t<decltype(result.counts)>::value_type::value_type;
+
+            std::size_t first = bins;
+            for (std::size_t b = 0; b < bins && first == bins; ++b)
+                if (!Fits<CountT>(exact[b]))
+                    first = b;
+
+            if (result.invalid.overflow != (invalid != n) || result.invalid.first != invalid)
+                Fail(what, "first invalid key " + std::to_string(result.invalid.first) + ", expected "
+                               + std::to_string(invalid));
+            if (result.status.overflow != (first != bins) || result.status.first != first)
+                Fail(what, "first overflow " + std::to_string(result.status.first) + ", expected "
+                               + std::to_string(first));
+            for (std::size_t b = 0; b < bins; ++b)
+                if (result.counts[b] != Wrap<CountT>(exact[b]))
+                {
+                    Fail(what, "bin " + std::to_string(b));
+                    break;
+                }
+        };
+
+        check("CheckedHistogram", CheckedHistogram(std::span<const KeyT>(keys), bins, options), counts);
+        // Narrow bins, so that the weights overflow some
+        check("CheckedHistogram weighted",
+              CheckedHistogram<std::int32_t>(std::span<const KeyT>(keys), std::span<const std::int32_t>(weights),
+                                             bins, options),
+              sums);
+    }
+}
+
+/**
+ * @brief Whether f throws std::overflow_error, as policy::Throw does on
+ *        overflow.
+ */
+template <typename F>
+bool Throws(F f)
+{
+    try
+    {
+        f();
+    }
+    catch (const std::overflow_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Exact result given by its sign and magnitude, so that magnitudes up
+ *        to 2^128 - 1 are representable.
+ */
+struct Exact
+{
+    bool negative = false;
+    UInt128 magnitude = 0;
+
+    static Exact Of(Int128 val)
+    {
+        return {val < 0, val < 0 ? UInt128{0} - static_cast<UInt128>(val) : static_cast<UInt128>(val)};
+    }
+
+    template <std::integral T>
+    [[nodiscard]] bool Fits() const
+    {
+        return magnitude <= (negative ? UInt128{checks::detail::Magnitude(std::numeric_limits<T>::min())}
+                                      : UInt128{std::numeric_limits<T>::max()});
+    }
+
+    /**
+     * @brief Value, only meaningful if it fits in a fixed-width type.
+     */
+    [[nodiscard]] Int128 Value() const
+    {
+        return negative ? -static_cast<Int128>(magnitude) : static_cast<Int128>(magnitude);
+    }
+};
+
+/**
+ * @brief Divides magnitudes of a value of the given sign, rounding as the
+ *        rounding mode is defined.
+ */
+UInt128 Rounded(UInt128 num, UInt128 den, bool negative, Rounding rounding)
+{
+    const UInt128 quotient = num / den;
+    const UInt128 twice_remainder = num % den * 2;
+    if (twice_remainder == 0)
+        return quotient;
+
+    bool away = false;
+    switch (rounding)
+    {
+    case Rounding::TowardZero: away = false; break;
+    case Rounding::Floor: away = negative; break;
+    case Rounding::Ceiling: away = !negative; break;
+    case Rounding::HalfUp: away = twice_remainder >= den; break;
+    case Rounding::HalfEven: away = twice_remainder > den || (twice_remainder == den && quotient % 2 == 1); break;
+    }
+    return quotient + away;
+}
+
+/**
+ * @brief Checks an operation, applied to a copy of lhs by op, against its exact
+ *        result, none if it must overflow.
+ */
+template <typename NumberT, typename Op, typename Units>
+void CheckNumber(const std::string &what, const NumberT &lhs, Op op, const std::optional<Exact> &exact,
+                 Units units)
+{
+    using T = std::remove_cvref_t<decltype(units(lhs))>;
+
+    const bool overflow = !exact || !exact->Fits<T>();
+
+    NumberT result = lhs;
+    if (Throws([&] { op(result); }) != overflow)
+        Fail(what, overflow ? "didn't overflow" : "overflowed");
+    else if (!overflow && units(result) != exact->Value())
+        Fail(what, "result " + ToString(units(result)) + ", expected " + ToString(exact->Value()));
+}
+
+/**
+ * @brief Checks the operations of Decimal against exact products and quotients
+ *        rounded in every mode.
+ */
+template <std::integral T, unsigned Scale>
+void TestDecimal(std::mt19937_64 &rng, std::size_t iterations)
+{
+    using D = Decimal<T, Scale, policy::Throw>;
+    using checks::detail::IsNegative;
+    using checks::detail::Magnitude;
+
+    constexpr Rounding roundings[] = {Rounding::TowardZero, Rounding::Floor, Rounding::Ceiling,
+                                      Rounding::HalfUp, Rounding::HalfEven};
+    const UInt128 factor = D::factor;
+    const auto units = [](const auto &d) { return d.Units().Get(); };
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const T a = Random<T>(rng);
+        const T b = Random<T>(rng);
+        const Rounding rounding = roundings[rng() % 5];
+        const D lhs = D::FromUnits(a);
+        const D rhs = D::FromUnits(b);
+        const bool negative = IsNegative(a) != IsNegative(b);
+        const std::string args = '(' + ToString(a) + ", " + ToString(b) + ") of Decimal<"
+                                 + ToString(std::numeric_limits<T>::digits) + ", " + ToString(Scale)
+                                 + ">, rounding " + ToString(static_cast<int>(rounding));
+
+        CheckNumber("Decimal::Decimal" + args, D{}, [&](D &d) { d = D(b); },
+                    Exact::Of(Int128{b} * D::factor), units);
+        CheckNumber("Decimal::operator+=" + args, lhs, [&](D &d) { d += rhs; }, Exact::Of(Int128{a} + b), units);
+        CheckNumber("Decimal::operator-=" + args, lhs, [&](D &d) { d -= rhs; }, Exact::Of(Int128{a} - b), units);
+
+        const UInt128 product = static_cast<UInt128>(Magnitude(a)) * Magnitude(b);
+        CheckNumber("Decimal::Mul" + args, lhs, [&](D &d) { d.Mul(rhs, rounding); },
+                    Exact{negative, Rounded(product, factor, negative, rounding)}, units);
+        CheckNumber("Decimal::Mul<RhsT>" + args, lhs, [&](D &d) { d.Mul(b); },
+                    Exact{negative, product}, units);
+
+        std::optional<Exact> quotient;
+        std::optional<Exact> integer_quotient;
+        if (b != 0)
+        {
+            quotient = Exact{negative, Rounded(Magnitude(a) * factor, Magnitude(b), negative, rounding)};
+            integer_quotient = Exact{negative, Rounded(Magnitude(a), Magnitude(b), negative, rounding)};
+        }
+        CheckNumber("Decimal::Div" + args, lhs, [&](D &d) { d.Div(rhs, rounding); }, quotient, units);
+        CheckNumber("Decimal::Div<RhsT>" + args, lhs, [&](D &d) { d.Div(b, rounding); }, integer_quotient,
+                    units);
+
+        if constexpr (Scale < static_cast<unsigned>(std::numeric_limits<T>::digits10))
+        {
+            using Up = Decimal<T, Scale + 1, policy::Throw>;
+            CheckNumber("Decimal::Rescale up" + args, Up{}, [&](Up &d) { d = lhs.template Rescale<Scale + 1>(); },
+                        Exact::Of(Int128{a} * 10), units);
+        }
+        if constexpr (Scale > 0)
+        {
+            using Down = Decimal<T, 0, policy::Throw>;
+            CheckNumber("Decimal::Rescale down" + args, Down{},
+                        [&](Down &d) { d = lhs.template Rescale<0>(rounding); },
+                        Exact{IsNegative(a), Rounded(Magnitude(a), factor, IsNegative(a), rounding)}, units);
+        }
+    }
+}
+
+/**
+ * @brief Checks the functions of checked_math.hpp against results computed in
+ *        __int128.
+ */
+template <std::integral T>
+void TestMath(std::mt19937_64 &rng, std::size_t iterations)
+{
+    using checks::detail::Magnitude;
+
+    const auto check = [](const std::string &what, const Checked<T> &result, const Exact &exact, T wrapped)
+    {
+        const bool overflow = !exact.Fits<T>();
+        if ((result.error == Error::Overflow) != overflow)
+            Fail(what, overflow ? "didn't overflow" : "overflowed");
+        else if (result.value != wrapped)
+            Fail(what, "result " + ToString(result.value) + ", expected " + ToString(wrapped));
+    };
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        // Pow: bases mostly small, so that some powers fit
+        const T base = rng() % 2 == 0 ? Random<T>(rng) : static_cast<T>(static_cast<int>(rng() % 15) - 7);
+        const unsigned exp = static_cast<unsigned>(rng() % 70);
+        // Magnitudes stop growing past 2^64, which no T holds
+        UInt128 wrapped = 1;
+        UInt128 magnitude = 1;
+        for (unsigned e = 0; e < exp; ++e)
+        {
+            wrapped *= static_cast<UInt128>(static_cast<Int128>(base));
+            if (magnitude <= UInt128{1} << 64)
+                magnitude *= Magnitude(base);
+        }
+        const Exact pow{checks::detail::IsNegative(base) && exp % 2 != 0, magnitude};
+        const std::string pow_args = '(' + ToString(base) + ", " + ToString(exp) + ')';
+        check("TryPow" + pow_args, TryPow(base, exp), pow, Wrap<T>(static_cast<Int128>(wrapped)));
+        if (Throws([&] { (void)CheckedPow<policy::Throw>(base, exp); }) != !pow.Fits<T>())
+            Fail("CheckedPow" + pow_args, "overflow");
+
+        // Factorial and Binomial, whose results are 0 on overflow
+        // Up to 33!, below 2^127
+        const std::uint64_t n = rng() % 34;
+        Int128 factorial = 1;
+        for (std::uint64_t f = 2; f <= n; ++f)
+            factorial *= f;
+        check("TryFactorial(" + ToString(n) + ')', TryFactorial<T>(n), Exact::Of(factorial),
+              Fits<T>(factorial) ? static_cast<T>(factorial) : T{0});
+
+        // C(m - j + 1, 1), C(m - j + 2, 2)... grow up to C(m, j), so they stop
+        // past 2^64
+        const std::uint64_t m = rng() % 8 == 0 ? rng() % 1000 : rng() % 136;
+        const std::uint64_t k = rng() % (m + 3);
+        Exact binomial;
+        if (k <= m)
+        {
+            const std::uint64_t j = std::min(k, m - k);
+            binomial.magnitude = 1;
+            for (std::uint64_t c = 1; c <= j && binomial.magnitude <= UInt128{1} << 64; ++c)
+                binomial.magnitude = binomial.magnitude * (m - j + c) / c;
+        }
+        check("TryBinomial(" + ToString(m) + ", " + ToString(k) + ')', TryBinomial<T>(m, k), binomial,
+              binomial.Fits<T>() ? static_cast<T>(binomial.Value()) : T{0});
+
+        // Gcd, Lcm and Midpoint
+        const T a = Random<T>(rng);
+        const T b = rng() % 4 == 0 ? Random<T>(rng) : static_cast<T>(a / static_cast<T>(rng() % 7 + 1));
+        const std::string args = '(' + ToString(a) + ", " + ToString(b) + ')';
+
+        UInt128 x = Magnitude(a);
+        UInt128 y = Magnitude(b);
+        while (y != 0)
+            x = std::exchange(y, x % y);
+        const UInt128 gcd = x;
+        check("TryGcd" + args, TryGcd(a, b), Exact{false, gcd}, Wrap<T>(static_cast<Int128>(gcd)));
+
+        const UInt128 lcm = gcd == 0 ? 0 : Magnitude(a) / gcd * Magnitude(b);
+        check("TryLcm" + args, TryLcm(a, b), Exact{false, lcm}, Wrap<T>(static_cast<Int128>(lcm)));
+
+        // Halves rounded toward a
+        const Int128 sum = Int128{a} + b;
+        const Int128 floor = sum >= 0 || sum % 2 == 0 ? sum / 2 : sum / 2 - 1;
+        const Int128 mid = sum % 2 == 0 || a < b ? floor : floor + 1;
+        if (Midpoint(IntWrapper<T>{a}, IntWrapper<T>{b}).Get() != mid)
+            Fail("Midpoint" + args, "result");
+    }
+}
+
+/**
+ * @brief Checks the operations of Rational against exact fractions computed
+ *        in __int128: an operation overflows only if its reduced result
+ *        doesn't fit. T is at most 64 bits and not std::uint64_t.
+ */
+template <std::integral T>
+void TestRational(std::mt19937_64 &rng, std::size_t iterations)
+{
+    using R = Rational<IntWrapper<T, policy::Throw>>;
+    using checks::detail::Magnitude;
+
+    // Mostly fractions with common factors, so that reducing them matters
+    const auto fraction = [&rng]() -> std::pair<T, T>
+    {
+        const T scale = static_cast<T>(rng() % 4 == 0 ? 1 : rng() % 12 + 1);
+        const T num = rng() % 2 == 0 ? Random<T>(rng) : static_cast<T>(Random<T>(rng) / scale * scale);
+        T den = rng() % 2 == 0 ? Random<T>(rng) : static_cast<T>(Random<T>(rng) / scale * scale);
+        if (den == 0 || checks::detail::IsNegative(den))
+            den = static_cast<T>(rng() % 100 + 1);
+        return {num, den};
+    };
+
+    const auto reduced = [](bool negative, UInt128 num, UInt128 den) -> std::optional<std::pair<Exact, Exact>>
+    {
+        UInt128 x = num;
+        UInt128 y = den;
+        while (y != 0)
+            x = std::exchange(y, x % y);
+        const Exact n{negative && num != 0, num / x};
+        const Exact d{false, den / x};
+        if (!n.Fits<T>() || !d.Fits<T>())
+            return std::nullopt;
+        return std::pair{n, d};
+    };
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const auto [a, b] = fraction();
+        const auto [c, d] = fraction();
+        const R lhs{IntWrapper<T, policy::Throw>{a}, IntWrapper<T, policy::Throw>{b}};
+        const R rhs{IntWrapper<T, policy::Throw>{c}, IntWrapper<T, policy::Throw>{d}};
+        const std::string args = '(' + ToString(a) + '/' + ToString(b) + ", " + ToString(c) + '/' + ToString(d)
+                                 + ')';
+
+        const auto check = [&](const std::string &what, auto op, bool negative, UInt128 num, UInt128 den,
+                               bool defined = true)
+        {
+            const auto exact = defined ? reduced(negative, num, den) : std::nullopt;
+            R result = lhs;
+            if (Throws([&] { op(result); }) != !exact)
+                Fail(what + args, exact ? "overflowed" : "didn't overflow");
+            // Cross-multiplied, |num| and den are below 2^64
+            else if (exact && Int128{result.Num().Get()} * exact->second.Value()
+                                  != exact->first.Value() * Int128{result.Den().Get()})
+                Fail(what + args, "result " + ToString(result.Num().Get()) + '/' + ToString(result.Den().Get()));
+        };
+
+        // Products below 2^126 in magnitude, and their sums below 2^127
+        const Exact ad = Exact::Of(Int128{a} * d);
+        const Exact cb = Exact::Of(Int128{c} * b);
+        const UInt128 bd = static_cast<UInt128>(b) * static_cast<UInt128>(d);
+        const Exact sum = Exact::Of(ad.Value() + cb.Value());
+        const Exact diff = Exact::Of(ad.Value() - cb.Value());
+
+        check("Rational::Add", [&](R &r) { r += rhs; }, sum.negative, sum.magnitude, bd);
+        check("Rational::Sub", [&](R &r) { r -= rhs; }, diff.negative, diff.magnitude, bd);
+        const bool negative = checks::detail::IsNegative(a) != checks::detail::IsNegative(c);
+        check("Rational::Mul", [&](R &r) { r *= rhs; }, negative,
+              static_cast<UInt128>(Magnitude(a)) * Magnitude(c), bd);
+        check("Rational::Div", [&](R &r) { r /= rhs; }, negative,
+              static_cast<UInt128>(Magnitude(a)) * static_cast<UInt128>(d),
+              static_cast<UInt128>(b) * Magnitude(c), c != 0);
+    }
+}
+
+/**
+ * @brief Checks CheckedMatmul against dot products summed in __int128, with
+ *        shapes that cover partial tiles and more than one block of the inner
+ *        dimension.
+ */
+template <std::integral T, std::integral OutT>
+void TestMatmul(std::mt19937_64 &rng, std::size_t iterations)
+{
+    for (std::size_t i = 0; i < iterations / 256 + 1; ++i)
+    {
+        const std::size_t rows = rng() % 20;
+        const std::size_t inner = rng() % 4 == 0 ? rng() % 600 : rng() % 40;
+        const std::size_t cols = rng() % 4 == 0 ? rng() % 140 : rng() % 20;
+
+        // Mostly small, so that some products don't overflow
+        const auto element = [&rng] { return rng() % 8 == 0 ? Random<T>(rng) : static_cast<T>(rng() % 16); };
+        std::vector<T> lhs(rows * inner);
+        std::vector<T> rhs(inner * cols);
+        for (T &val : lhs)
+            val = element();
+        for (T &val : rhs)
+            val = element();
+
+        std::vector<OutT> out(rows * cols);
+        const BatchResult result = CheckedMatmul(std::span<const T>(lhs), std::span<const T>(rhs),
+                                                 std::span<OutT>(out), rows, inner, cols);
+
+        std::size_t first = rows * cols;
+        for (std::size_t r = 0; r < rows; ++r)
+            for (std::size_t c = 0; c < cols; ++c)
+            {
+                Int128 dot = 0;
+                for (std::size_t k = 0; k < inner; ++k)
+                    dot += Int128{lhs[r * inner + k]} * rhs[k * cols + c];
+
+                const std::size_t idx = r * cols + c;
+                if (first == rows * cols && !Fits<OutT>(dot))
+                    first = idx;
+                if (out[idx] != Wrap<OutT>(dot))
+                {
+                    Fail("CheckedMatmul", "element " + std::to_string(idx) + " of " + std::to_string(rows) + 'x'
+                                              + std::to_string(inner) + " by " + std::to_string(inner) + 'x'
+                                              + std::to_string(cols));
+                    return;
+                }
+            }
+
+        if (result.overflow != (first != rows * cols) || result.first != first)
+            Fail("CheckedMatmul", "first overflow " + std::to_string(result.first) + ", expected "
+                                      + std::to_string(first));
+    }
+}
+
+/**
+ * @brief Checks DurationCast from FromDuration to ToDuration, whose
+ *        representation must be a wrapper with policy::Throw, against the
+ *        count scaled in __int128 as std::chrono::duration_cast scales it.
+ */
+template <typename FromDuration, typename ToDuration>
+void TestDurationCast(const char *what, std::mt19937_64 &rng, std::size_t iterations)
+{
+    using FromT = detail::RawType<typename FromDuration::rep>;
+    using ToT = detail::RawType<typename ToDuration::rep>;
+    using CommonT = std::common_type_t<FromT, ToT, std::intmax_t>;
+    using Ratio = std::ratio_divide<typename FromDuration::period, typename ToDuration::period>;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const FromT count = Random<FromT>(rng);
+
+        // The product is computed in CommonT, by magnitude if it's unsigned
+        const Exact product = Exact::Of(Int128{count} * Ratio::num);
+        const bool product_fits = std::is_signed_v<CommonT> ? product.Fits<CommonT>()
+                                                            : product.magnitude <= std::numeric_limits<CommonT>::max();
+        const Exact exact = Exact::Of(product.Value() / Ratio::den);
+        const bool overflow = !product_fits || !exact.Fits<ToT>();
+
+        ToT result{};
+        const bool threw = Throws([&]
+        {
+            result = detail::RawRef(DurationCast<ToDuration>(FromDuration{typename FromDuration::rep(count)}).count());
+        });
+        if (threw != overflow)
+            Fail(what, "count " + ToString(count) + (overflow ? " didn't overflow" : " overflowed"));
+        else if (!overflow && result != exact.Value())
+            Fail(what, "count " + ToString(count) + ", result " + ToString(result));
+    }
+}
+
+void TestDurationCasts(std::mt19937_64 &rng, std::size_t iterations)
+{
+    using namespace std::chrono;
+    using I16 = IntWrapper<std::int16_t, policy::Throw>;
+    using I32 = IntWrapper<std::int32_t, policy::Throw>;
+    using I64 = IntWrapper<std::int64_t, policy::Throw>;
+    using U32 = IntWrapper<std::uint32_t, policy::Throw>;
+    using U64 = IntWrapper<std::uint64_t, policy::Throw>;
+
+    TestDurationCast<duration<std::int64_t, std::nano>, duration<I32>>("DurationCast ns to s", rng, iterations);
+    TestDurationCast<duration<std::int64_t>, duration<I64, std::nano>>("DurationCast s to ns", rng, iterations);
+    TestDurationCast<duration<std::int32_t, std::ratio<60>>, duration<U32, std::milli>>(
+        "DurationCast min to unsigned ms", rng, iterations);
+    TestDurationCast<duration<I64, std::ratio<1, 3>>, duration<I64, std::milli>>(
+        "DurationCast thirds to ms", rng, iterations);
+    TestDurationCast<duration<std::uint64_t, std::micro>, duration<I16, std::milli>>(
+        "DurationCast unsigned us to ms", rng, iterations);
+    TestDurationCast<duration<std::int64_t, std::ratio<3600>>, duration<U64>>(
+        "DurationCast h to unsigned s", rng, iterations);
+}
+
+// Literals and constants, whose overflows fail to compile, against the same
+// literals without a suffix
+using namespace overflow::literals;
+
+static_assert(127_i8 == 127 && 0x7F_i8 == 0x7F && 0b111'1111_i8 == 127);
+static_assert(0xFF_u8 == 0xFF && 0377_u8 == 0377 && 0b1111'1111_u8 == 255);
+static_assert(32'767_i16 == 32767 && 0xFFFF_u16 == 0xFFFF && 0177777_u16 == 0177777);
+static_assert(2'147'483'647_i32 == 2147483647 && 0xFFFF'FFFF_u32 == 0xFFFFFFFF);
+static_assert(9'223'372'036'854'775'807_i64 == 9223372036854775807);
+static_assert(0xFFFF'FFFF'FFFF'FFFF_u64 == 0xFFFFFFFFFFFFFFFF && 0_u64 == 0 && 00_u64 == 0);
+static_assert(-(128_i16) == -128);
+
+// One past the range of each literal, which its static_assert rejects
+static_assert(checks::Assign<std::int8_t>(ct::detail::ParseLiteral<'1', '2', '8'>().value));
+static_assert(checks::Assign<std::uint8_t>(ct::detail::ParseLiteral<'0', 'x', '1', '0', '0'>().value));
+static_assert(ct::detail::ParseLiteral<'1', '8', '4', '4', '6', '7', '4', '4', '0', '7', '3', '7', '0', '9', '5',
+                                       '5', '1', '6', '1', '6'>()
+                  .error
+              == Error::Overflow);
+static_assert(!ct::detail::IsIntegerLiteral<'1', 'e', '3'>() && !ct::detail::IsIntegerLiteral<'0', '8'>()
+              && !ct::detail::IsIntegerLiteral<'0', 'b', '2'>() && !ct::detail::IsIntegerLiteral<'0', 'x', 'g'>());
+
+static_assert(ct::Add<std::int32_t{2147483646}, 1>() == 2147483647 && ct::Sub<std::uint8_t{0}, 0>() == 0);
+static_assert(ct::Mul<std::int64_t{-4611686018427387904}, 2>() == std::numeric_limits<std::int64_t>::min());
+static_assert(ct::Div<std::int16_t{-32767}, -1>() == 32767 && ct::Shl<std::uint16_t{1}, 15>() == 0x8000);
+static_assert(ct::Neg<std::int8_t{127}>() == -127 && ct::Cast<std::uint8_t, 255>() == 255);
+
+} // namespace
+
+
+
+
+
+int main(int argc, char *argv[])
+{
+    seed = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1;
+    const std::size_t iterations = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000;
+
+    std::mt19937_64 rng{seed};
+
+    ForEachType(FixedWidth{}, [&]<typename Lhs>(std::type_identity<Lhs>)
+    {
+        ForEachType(FixedWidth{}, [&]<typename Rhs>(std::type_identity<Rhs>)
+        {
+            TestPair<Lhs, Rhs>(rng, iterations);
+        });
+        // bool operands, which promote to int like the other narrow types
+        TestPair<Lhs, bool>(rng, iterations);
+        TestUnary<Lhs>(rng, iterations);
+        TestColumn<Lhs>(rng, iterations);
+        TestHistogram<Lhs>(rng, iterations);
+        TestDecimal<Lhs, 2>(rng, iterations);
+        TestMath<Lhs>(rng, iterations);
+        // Sums of the cross products of uint64_t fractions need 129 bits
+        if constexpr (std::is_signed_v<Lhs> || sizeof(Lhs) < sizeof(std::uint64_t))
+            TestRational<Lhs>(rng, iterations);
+    });
+
+    TestDecimal<std::int64_t, 9>(rng, iterations);
+    TestDecimal<std::uint64_t, 18>(rng, iterations);
+    TestMatmul<std::int8_t, std::int32_t>(rng, iterations);
+    TestMatmul<std::int8_t, std::uint8_t>(rng, iterations);
+    TestMatmul<std::uint8_t, std::int16_t>(rng, iterations);
+    TestMatmul<std::int16_t, std::int32_t>(rng, iterations);
+    TestMatmul<std::int32_t, std::int64_t>(rng, iterations);
+    TestMatmul<std::uint32_t, std::uint64_t>(rng, iterations);
+    TestDurationCasts(rng, iterations);
+
+    std::printf("%s backend: %zu failures\n", backend_name, failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
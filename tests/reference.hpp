@@ -0,0 +1,317 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file reference.hpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Checks the operations of the configured backend against exact
+ *          results computed in __int128.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Shared by the randomized tests and the fuzz target. Every operand of the
+ * fixed-width types has an exact result in __int128 for the operations of
+ * checks::Operation, so each check, wrapped result, Try* function and
+ * IntWrapper operator is compared against it.
+ */
+
+
+
+
+
+#ifndef OVERFLOWWRAPPER_TESTS_REFERENCE_HPP
+#define OVERFLOWWRAPPER_TESTS_REFERENCE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "../include/intwrapper.hpp"
+
+#ifndef __SIZEOF_INT128__
+#error "The tests need __int128"
+#endif
+
+
+
+
+
+namespace overflow::test
+{
+
+__extension__ using Int128 = __int128;
+__extension__ using UInt128 = unsigned __int128;
+
+/**
+ * @brief The fixed-width types, every pair of which is tested.
+ */
+template <typename... Ts>
+struct Types
+{
+};
+
+using FixedWidth = Types<std::int8_t, std::int16_t, std::int32_t, std::int64_t,
+                         std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t>;
+
+template <typename... Ts, typename F>
+void ForEachType(Types<Ts...>, F f)
+{
+    (f(std::type_identity<Ts>{}), ...);
+}
+
+/**
+ * @brief Whether an exact result fits in T.
+ */
+template <std::integral T>
+constexpr bool Fits(const Int128 &val)
+{
+    return val >= std::numeric_limits<T>::min() && val <= std::numeric_limits<T>::max();
+}
+
+/**
+ * @brief Wraps an exact result around the range of T.
+ */
+template <std::integral T>
+constexpr T Wrap(const Int128 &val)
+{
+    return static_cast<T>(static_cast<std::make_unsigned_t<T>>(static_cast<UInt128>(val)));
+}
+
+inline std::string ToString(Int128 val)
+{
+    const bool negative = val < 0;
+    UInt128 magnitude = negative ? UInt128{0} - static_cast<UInt128>(val) : static_cast<UInt128>(val);
+
+    std::string digits;
+    do
+    {
+        digits.insert(digits.begin(), static_cast<char>('0' + magnitude % 10));
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    return negative ? '-' + digits : digits;
+}
+
+/**
+ * @brief Exact result of an operation, none for shift counts out of range.
+ *        Division by zero isn't defined and must be skipped.
+ */
+template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+std::optional<Int128> Exact(const LhsT &lhs, const RhsT &rhs)
+{
+    using checks::Operation;
+    constexpr int width = std::numeric_limits<std::make_unsigned_t<LhsT>>::digits;
+
+    const Int128 l = lhs;
+    const Int128 r = rhs;
+
+    if constexpr (O == Operation::Assign)
+        return r;
+    else if constexpr (O == Operation::Sum)
+        return l + r;
+    else if constexpr (O == Operation::Sub)
+        return l - r;
+    else if constexpr (O == Operation::Mul)
+    {
+        // Modulo 2^128, only the product of two uint64_t can exceed the range
+        // of Int128, and then it doesn't fit in uint64_t either
+        return static_cast<Int128>(static_cast<UInt128>(l) * static_cast<UInt128>(r));
+    }
+    else if constexpr (O == Operation::Div)
+        return l / r;
+    else if constexpr (O == Operation::Shl || O == Operation::Shr)
+    {
+        if (r < 0 || r >= width)
+            return std::nullopt;
+        // Below 2^127 in magnitude, since |lhs| <= 2^64 and the count < 64
+        return O == Operation::Shl ? l * (Int128{1} << static_cast<int>(r))
+                                   : l >> static_cast<int>(r);
+    }
+    else if constexpr (O == Operation::Inc)
+        return l + 1;
+    else if constexpr (O == Operation::Dec)
+        return l - 1;
+    else
+        return -l;
+}
+
+/**
+ * @brief Applies an operation through the compound assignment or increment of
+ *        IntWrapper under policy::Throw.
+ *
+ * @return Whether it threw
+ */
+template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+bool ThrowsThroughWrapper(const LhsT &lhs, const RhsT &rhs, LhsT &result)
+{
+    using checks::Operation;
+
+    IntWrapper<LhsT, policy::Throw> w;
+    w.Get() = lhs;
+
+    try
+    {
+        if constexpr (O == Operation::Assign)
+            w = rhs;
+        else if constexpr (O == Operation::Sum)
+            w += rhs;
+        else if constexpr (O == Operation::Sub)
+            w -= rhs;
+        else if constexpr (O == Operation::Mul)
+            w *= rhs;
+        else if constexpr (O == Operation::Div)
+            w /= rhs;
+        else if constexpr (O == Operation::Shl)
+            w <<= rhs;
+        else if constexpr (O == Operation::Shr)
+            w >>= rhs;
+        else if constexpr (O == Operation::Inc)
+            ++w;
+        else if constexpr (O == Operation::Dec)
+            --w;
+        else
+            w = -w;
+    }
+    catch (const std::overflow_error &)
+    {
+        return true;
+    }
+
+    result = w.Get();
+    return false;
+}
+
+/**
+ * @brief Applies an operation through the binary operator of IntWrapper,
+ *        which computes it in the common type of the operands.
+ *
+ * @return Whether it threw
+ */
+template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+bool ThrowsThroughBinary(const LhsT &lhs, const RhsT &rhs, std::common_type_t<LhsT, RhsT> &result)
+{
+    using checks::Operation;
+
+    const IntWrapper<LhsT, policy::Throw> w{lhs};
+
+    try
+    {
+        if constexpr (O == Operation::Sum)
+            result = (w + rhs).Get();
+        else if constexpr (O == Operation::Sub)
+            result = (w - rhs).Get();
+        else if constexpr (O == Operation::Mul)
+            result = (w * rhs).Get();
+        else
+            result = (w / rhs).Get();
+    }
+    catch (const std::overflow_error &)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Result of a Try* function, if the operation has one.
+ */
+template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+std::optional<Checked<LhsT>> TryResult(const LhsT &lhs, const RhsT &rhs)
+{
+    using checks::Operation;
+
+    if constexpr (O == Operation::Assign)
+        return TryAssign<LhsT>(rhs);
+    else if constexpr (O == Operation::Sum)
+        return TryAdd(lhs, rhs);
+    else if constexpr (O == Operation::Sub)
+        return TrySub(lhs, rhs);
+    else if constexpr (O == Operation::Mul)
+        return TryMul(lhs, rhs);
+    else if constexpr (O == Operation::Div)
+        return TryDiv(lhs, rhs);
+    else
+        return std::nullopt;
+}
+
+/**
+ * @brief Compares an operation on a pair of operands against its exact result.
+ *
+ * @return Description of the first mismatch, empty if there is none
+ */
+template <checks::Operation O, std::integral LhsT, std::integral RhsT>
+std::string Verify(const LhsT &lhs, const RhsT &rhs)
+{
+    using checks::Operation;
+
+    if constexpr (O == Operation::Div)
+    {
+        if (rhs == 0)
+            return TryDiv(lhs, rhs).error == Error::DivisionByZero ? "" : "TryDiv by zero";
+    }
+
+    const std::optional<Int128> exact = Exact<O>(lhs, rhs);
+    const bool overflow = !exact || !Fits<LhsT>(*exact);
+
+    if (checks::Run<O>(lhs, rhs) != overflow)
+        return "check";
+
+    // Results wrap around modulo 2^N, when they exist
+    const LhsT wrapped = wrapping::Run<O>(lhs, rhs);
+    if (exact && wrapped != Wrap<LhsT>(*exact))
+        return "wrapped result";
+
+    if (const auto tried = TryResult<O>(lhs, rhs))
+    {
+        if ((tried->error == Error::Overflow) != overflow)
+            return "Try* error";
+        // Except TryDiv, which keeps lhs on overflow
+        if ((O != Operation::Div || !overflow) && tried->value != Wrap<LhsT>(*exact))
+            return "Try* result";
+    }
+
+    LhsT result{};
+    if (ThrowsThroughWrapper<O>(lhs, rhs, result) != overflow)
+        return "IntWrapper overflow";
+    if (!overflow && result != *exact)
+        return "IntWrapper result";
+
+    if constexpr (O == Operation::Sum || O == Operation::Sub || O == Operation::Mul
+                  || O == Operation::Div)
+    {
+        using C = std::common_type_t<LhsT, RhsT>;
+
+        // A dividend is converted to C first, which a negative one of an
+        // unsigned C doesn't survive
+        const bool binary_overflow = !Fits<C>(*exact) || (O == Operation::Div && !Fits<C>(lhs));
+
+        C binary{};
+        if (ThrowsThroughBinary<O>(lhs, rhs, binary) != binary_overflow)
+            return "binary operator overflow";
+        if (!binary_overflow && binary != *exact)
+            return "binary operator result";
+    }
+
+    return "";
+}
+
+} // namespace overflow::test
+
+#endif // #ifndef OVERFLOWWRAPPER_TESTS_REFERENCE_HPP
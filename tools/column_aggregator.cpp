@@ -0,0 +1,109 @@
+/*
+    Copyright © 2021 Luiz Fernando F. G. Valle
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file column_aggregator.cpp
+ * @author Luiz Fernando F. G. Valle
+ * @brief Prints the checked count, sum, minimum and maximum of every integer
+ *          column of a delimited text file.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ * Usage: column_aggregator [-d DELIMITER] [-H] [-t THREADS] FILE
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <unistd.h>
+
+#include "../include/column_aggregator.hpp"
+
+
+
+
+
+namespace
+{
+
+[[noreturn]] void Usage(const char *argv0)
+{
+    std::fprintf(stderr, "Usage: %s [-d DELIMITER] [-H] [-t THREADS] FILE\n", argv0);
+    std::exit(2);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    overflow::AggregateOptions options;
+
+    for (int opt; (opt = ::getopt(argc, argv, "d:Ht:")) != -1;)
+    {
+        switch (opt)
+        {
+        case 'd':
+            if (optarg[0] == '\0' || optarg[1] != '\0')
+                Usage(argv[0]);
+            options.delimiter = optarg[0];
+            break;
+        case 'H':
+            options.header = true;
+            break;
+        case 't':
+            options.threads = static_cast<unsigned>(std::strtoul(optarg, nullptr, 10));
+            break;
+        default:
+            Usage(argv[0]);
+        }
+    }
+
+    if (optind + 1 != argc)
+        Usage(argv[0]);
+
+    try
+    {
+        const auto stats = overflow::AggregateColumns<std::int64_t>(argv[optind], options);
+
+        std::printf("column,count,sum,min,max,overflow_row,error_row\n");
+        for (std::size_t c = 0; c < stats.size(); ++c)
+        {
+            const auto &col = stats[c];
+            if (col.count == 0u)
+            {
+                std::printf("%zu,0,0,,,%llu,%llu\n", c,
+                            static_cast<unsigned long long>(col.overflow_row),
+                            static_cast<unsigned long long>(col.error_row));
+                continue;
+            }
+
+            std::printf("%zu,%llu,%lld,%lld,%lld,%llu,%llu\n", c,
+                        static_cast<unsigned long long>(col.count.Get()),
+                        static_cast<long long>(col.sum.Get()),
+                        static_cast<long long>(col.min),
+                        static_cast<long long>(col.max),
+                        static_cast<unsigned long long>(col.overflow_row),
+                        static_cast<unsigned long long>(col.error_row));
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::fprintf(stderr, "%s: %s\n", argv[0], e.what());
+        return 1;
+    }
+}